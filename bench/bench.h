@@ -0,0 +1,27 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <iostream>
+#include <string>
+#include <time.h>
+#include <stdint.h>
+
+// helpers shared by the benchmark programs
+
+inline double now(){
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec/1000000000.0;
+}
+
+// prints one result line: name, seconds, and the rate of each unit counted
+inline void report(const std::string &name, double seconds, uint64_t items, const char *unit, uint64_t bytes = 0){
+	std::cout << name << ": " << seconds << " s";
+	if (items)
+		std::cout << ", " << items/seconds << " " << unit << "/s";
+	if (bytes)
+		std::cout << ", " << bytes/seconds/1000000.0 << " MB/s";
+	std::cout << "\n";
+}
+
+#endif
@@ -0,0 +1,160 @@
+#include <iostream>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "libosmpbf.h"
+
+// Writes a synthetic PBF file sorted by type then id. The same options always
+// produce the same file, so results can be compared between builds.
+
+// splitmix64; deterministic on every platform, unlike rand()
+static uint64_t state;
+static uint64_t random64(){
+	uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+	return z ^ (z >> 31);
+}
+
+static double uniform(){
+	return (random64() >> 11) * (1.0/9007199254740992.0);
+}
+
+// a length which averages mean, at least 1
+static int length(double mean){
+	return 1 + (int)(uniform()*2*(mean-1) + 0.5);
+}
+
+static const char *keys[] = {"highway", "name", "amenity", "building", "surface", "source", "addr:street", "addr:housenumber"};
+static const char *values[] = {"residential", "yes", "restaurant", "asphalt", "survey", "Main Street", "service", "12"};
+static const int vocabulary = 8;
+
+static void tag(std::map<std::string, std::string> &tags, int count){
+	for (int t = 0; t < count; t++)
+		tags[keys[random64() % vocabulary]] = values[random64() % vocabulary];
+}
+
+static void info(libosmpbf::Info &info, uint64_t id){
+	info.version = 1 + random64() % 5;
+	info.timestamp = 1300000000 + random64() % 200000000;
+	info.changeset = 1000000 + id/50;
+	info.uid = random64() % 1000;
+	info.user = "user" + std::to_string(info.uid);
+}
+
+static void usage(const char *name){
+	std::cout << "Usage: " << name << " [OPTIONS] [FILE]\n"
+		<< "\t-n NODES       number of nodes (1000000)\n"
+		<< "\t-w WAYS        number of ways (100000)\n"
+		<< "\t-r RELATIONS   number of relations (5000)\n"
+		<< "\t-b OBJECTS     objects per block (8000)\n"
+		<< "\t-t DENSITY     fraction of nodes with tags (0.05)\n"
+		<< "\t-l LENGTH      average nodes per way (10)\n"
+		<< "\t-m MEMBERS     average members per relation (20)\n"
+		<< "\t-s SEED        random seed (1)\n";
+}
+
+int main(int argc, char *argv[]){
+
+	uint64_t nodes = 1000000, ways = 100000, relations = 5000;
+	size_t blockSize = libosmpbf::BlockBuilder::blockObjects;
+	double density = 0.05, wayLength = 10, relationSize = 20;
+	state = 1;
+
+	int opt;
+	while ((opt = getopt(argc, argv, "n:w:r:b:t:l:m:s:")) != -1){
+		switch (opt){
+		case 'n': nodes = strtoull(optarg, NULL, 10); break;
+		case 'w': ways = strtoull(optarg, NULL, 10); break;
+		case 'r': relations = strtoull(optarg, NULL, 10); break;
+		case 'b': blockSize = strtoull(optarg, NULL, 10); break;
+		case 't': density = atof(optarg); break;
+		case 'l': wayLength = atof(optarg); break;
+		case 'm': relationSize = atof(optarg); break;
+		case 's': state = strtoull(optarg, NULL, 10); break;
+		default: usage(argv[0]); return 1;
+		}
+	}
+
+	if (optind != argc-1 || nodes == 0 || blockSize == 0){
+		usage(argv[0]);
+		return 1;
+	}
+
+	libosmpbf::OPbfStream out(argv[optind], true);
+	libosmpbf::BlockBuilder builder;
+	libosmpbf::PbfBlock block;
+
+	// nodes wander about like a digitized road network
+	double lat = 45.0, lon = -75.0;
+	for (uint64_t id = 1; id <= nodes; id++){
+		libosmpbf::Node node;
+		node.id = id;
+		lat += (uniform() - 0.5) * 0.001;
+		lon += (uniform() - 0.5) * 0.001;
+		node.coords.lat = lat;
+		node.coords.lon = lon;
+		if (uniform() < density)
+			tag(node.tags, length(3));
+		info(node.info, id);
+
+		builder.add(node);
+		if (builder.objects() >= blockSize){
+			builder.build(block);
+			out << block;
+		}
+	}
+
+	// each way refers to a run of nearby nodes
+	for (uint64_t id = 1; id <= ways; id++){
+		libosmpbf::Way way;
+		way.id = id;
+		uint64_t ref = 1 + random64() % nodes;
+		int count = length(wayLength);
+		for (int n = 0; n < count; n++){
+			way.nodeIds.push_back(ref);
+			ref = ref % nodes + 1;
+		}
+		tag(way.tags, length(3));
+		info(way.info, id);
+
+		builder.add(way);
+		if (builder.objects() >= blockSize){
+			builder.build(block);
+			out << block;
+		}
+	}
+
+	for (uint64_t id = 1; id <= relations; id++){
+		libosmpbf::Relation relation;
+		relation.id = id;
+		int count = length(relationSize);
+		for (int n = 0; n < count; n++){
+			if (ways > 0 && random64() % 4 != 0)
+				relation.members.push_back(libosmpbf::Relation::Member(1 + random64() % ways, libosmpbf::Member_Way, "outer"));
+			else
+				relation.members.push_back(libosmpbf::Relation::Member(1 + random64() % nodes, libosmpbf::Member_Node, "stop"));
+		}
+		relation.tags["type"] = "route";
+		tag(relation.tags, length(3));
+		info(relation.info, id);
+
+		builder.add(relation);
+		if (builder.objects() >= blockSize){
+			builder.build(block);
+			out << block;
+		}
+	}
+
+	if (builder.objects() > 0){
+		builder.build(block);
+		out << block;
+	}
+
+	if (!out){
+		std::cout << "Unable to write " << argv[optind] << "\n";
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,237 @@
+#include <iostream>
+#include <fstream>
+#include <list>
+#include <vector>
+#include <stdlib.h>
+#include <zlib.h>
+#include <netinet/in.h>
+
+#include "protobuf/osm.pb.h"
+#include "libosmpbf.h"
+#include "bench.h"
+
+// Times each stage of reading a PBF file in isolation: inflating blobs,
+// parsing blocks, and the ways of getting at the objects in decoded blocks.
+
+using namespace libosmpbf;
+
+// reads the compressed data blobs of the file the same way PbfStream does
+static bool readBlobs(const char *file, std::vector<OSMPBF::Blob> &blobs){
+	std::ifstream in(file, std::ios_base::binary);
+	uint32_t size;
+	while (in.read((char*)&size, sizeof(size))){
+		std::string data(ntohl(size), '\0');
+		OSMPBF::BlobHeader header;
+		if (!in.read(&data[0], data.size()) || !header.ParseFromString(data))
+			return false;
+
+		data.resize(header.datasize());
+		OSMPBF::Blob blob;
+		if (!in.read(&data[0], data.size()) || !blob.ParseFromString(data))
+			return false;
+
+		if (header.type() == "OSMData")
+			blobs.push_back(blob);
+	}
+	return true;
+}
+
+// a handler for apply() that wants every kind of object
+struct IdSum {
+	IdSum() : sum(0), count(0){}
+	void node(const BlockNode &node){sum += node.id(); count++;}
+	void way(const BlockWay &way){sum += way.id(); count++;}
+	void relation(const BlockRelation &relation){sum += relation.id(); count++;}
+	uint64_t sum, count;
+};
+
+int main(int argc, char *argv[]){
+
+	if (argc < 2 || argc > 3){
+		std::cout << "Usage: " << argv[0] << " [FILE] [PASSES]\n";
+		return 0;
+	}
+
+	int passes = argc == 3 ? atoi(argv[2]) : 5;
+
+	std::vector<OSMPBF::Blob> blobs;
+	if (!readBlobs(argv[1], blobs)){
+		std::cout << "Unable to read " << argv[1] << "\n";
+		return 1;
+	}
+
+	// inflate
+	std::vector<std::string> raw(blobs.size());
+	uint64_t rawBytes = 0;
+	double start = now();
+	for (int pass = 0; pass < passes; pass++){
+		rawBytes = 0;
+		for (size_t b = 0; b < blobs.size(); b++){
+			raw[b].resize(blobs[b].raw_size());
+			uLongf size = raw[b].size();
+			uncompress((Bytef*)&raw[b][0], &size, (const Bytef*)blobs[b].zlib_data().data(), blobs[b].zlib_data().size());
+			rawBytes += size;
+		}
+	}
+	report("inflate", now() - start, 0, "", rawBytes*passes);
+
+	// parse
+	OSMPBF::PrimitiveBlock primitiveBlock;
+	start = now();
+	for (int pass = 0; pass < passes; pass++){
+		for (size_t b = 0; b < raw.size(); b++)
+			primitiveBlock.ParseFromString(raw[b]);
+	}
+	report("parse", now() - start, 0, "", rawBytes*passes);
+
+	// everything else works on decoded blocks
+	std::list<PbfBlock> blocks;
+	PbfStream pbf(argv[1]);
+	PbfBlock block;
+	while (pbf >> block)
+		blocks.push_back(block);
+
+	// values are summed so the compiler cannot drop the loops
+	uint64_t sum = 0, count = 0;
+
+	start = now();
+	for (int pass = 0; pass < passes; pass++){
+		for (std::list<PbfBlock>::iterator b = blocks.begin(); b != blocks.end(); b++){
+			for (PbfBlock::NodeIterator i = b->nodesBegin(); i != b->nodesEnd(); i.next()){
+				const BlockNode &node = *i;
+				sum += node.id() + (uint64_t)node.coords().lat;
+				count++;
+			}
+		}
+	}
+	report("dense node iteration", now() - start, count, "nodes");
+
+	count = 0;
+	start = now();
+	for (int pass = 0; pass < passes; pass++){
+		for (std::list<PbfBlock>::iterator b = blocks.begin(); b != blocks.end(); b++){
+			for (PbfBlock::WayIterator i = b->waysBegin(); i != b->waysEnd(); i.next()){
+				const BlockWay &way = *i;
+				for (int n = 0; n < way.nodes(); n++)
+					sum += way.nodes(n);
+				count += way.nodes();
+			}
+		}
+	}
+	report("BlockWay::nodes", now() - start, count, "refs");
+
+	std::vector<uint64_t> refs;
+	count = 0;
+	start = now();
+	for (int pass = 0; pass < passes; pass++){
+		for (std::list<PbfBlock>::iterator b = blocks.begin(); b != blocks.end(); b++){
+			for (PbfBlock::WayIterator i = b->waysBegin(); i != b->waysEnd(); i.next()){
+				count += (*i).refs(refs);
+				for (size_t n = 0; n < refs.size(); n++)
+					sum += refs[n];
+			}
+		}
+	}
+	report("BlockWay::refs", now() - start, count, "refs");
+
+	// bbox, length and area of every way, from locations held in memory
+	NodeLocations locations;
+	for (std::list<PbfBlock>::iterator b = blocks.begin(); b != blocks.end(); b++)
+		locations.add(*b);
+	GeometryBuilder geometry(locations);
+	std::vector<WayGeometry> geometries;
+	count = 0;
+	start = now();
+	for (int pass = 0; pass < passes; pass++){
+		for (std::list<PbfBlock>::iterator b = blocks.begin(); b != blocks.end(); b++){
+			geometry.block(*b, geometries);
+			count += geometries.size();
+		}
+	}
+	report("way geometry", now() - start, count, "ways");
+
+	// looks for one key the way most filters do, by comparing every tag
+	count = 0;
+	start = now();
+	for (int pass = 0; pass < passes; pass++){
+		for (std::list<PbfBlock>::iterator b = blocks.begin(); b != blocks.end(); b++){
+			for (PbfBlock::NodeIterator i = b->nodesBegin(); i != b->nodesEnd(); i.next()){
+				const BlockNode &node = *i;
+				for (int t = 0; t < node.tags(); t++, count++)
+					sum += node.tags(t).first == "amenity";
+			}
+			for (PbfBlock::WayIterator i = b->waysBegin(); i != b->waysEnd(); i.next()){
+				const BlockWay &way = *i;
+				for (int t = 0; t < way.tags(); t++, count++)
+					sum += way.tags(t).first == "amenity";
+			}
+			for (PbfBlock::RelationIterator i = b->relationsBegin(); i != b->relationsEnd(); i.next()){
+				const BlockRelation &relation = *i;
+				for (int t = 0; t < relation.tags(); t++, count++)
+					sum += relation.tags(t).first == "amenity";
+			}
+		}
+	}
+	report("tag scan", now() - start, count, "tags");
+
+	count = 0;
+	start = now();
+	for (int pass = 0; pass < passes; pass++){
+		for (std::list<PbfBlock>::iterator b = blocks.begin(); b != blocks.end(); b++){
+			for (PbfBlock::NodeIterator i = b->nodesBegin(); i != b->nodesEnd(); i.next(), count++)
+				sum += (*i).clone().tags.size();
+			for (PbfBlock::WayIterator i = b->waysBegin(); i != b->waysEnd(); i.next(), count++)
+				sum += (*i).clone().nodeIds.size();
+			for (PbfBlock::RelationIterator i = b->relationsBegin(); i != b->relationsEnd(); i.next(), count++)
+				sum += (*i).clone().members.size();
+		}
+	}
+	report("clone", now() - start, count, "objects");
+
+	// every object through one apply() walk per block, against the three
+	// iterator loops the same visit otherwise takes
+	count = 0;
+	start = now();
+	for (int pass = 0; pass < passes; pass++){
+		for (std::list<PbfBlock>::iterator b = blocks.begin(); b != blocks.end(); b++){
+			for (PbfBlock::NodeIterator i = b->nodesBegin(); i != b->nodesEnd(); i.next(), count++)
+				sum += (*i).id();
+			for (PbfBlock::WayIterator i = b->waysBegin(); i != b->waysEnd(); i.next(), count++)
+				sum += (*i).id();
+			for (PbfBlock::RelationIterator i = b->relationsBegin(); i != b->relationsEnd(); i.next(), count++)
+				sum += (*i).id();
+		}
+	}
+	report("iterator loops", now() - start, count, "objects");
+
+	IdSum ids;
+	start = now();
+	for (int pass = 0; pass < passes; pass++){
+		for (std::list<PbfBlock>::iterator b = blocks.begin(); b != blocks.end(); b++)
+			apply(*b, ids);
+	}
+	report("apply", now() - start, ids.count, "objects");
+	sum += ids.sum;
+
+	// the same objects decoded into columns instead, on one thread and then
+	// on every core
+	std::vector<PbfBlock> blockVector(blocks.begin(), blocks.end());
+	std::vector<BlockColumns> tables;
+	unsigned threads[] = {1, 0};
+	for (int t = 0; t < 2; t++){
+		ColumnConverter converter(threads[t]);
+		count = 0;
+		start = now();
+		for (int pass = 0; pass < passes; pass++){
+			converter.convert(blockVector, tables);
+			for (size_t b = 0; b < tables.size(); b++){
+				count += tables[b].nodes.id.size() + tables[b].ways.id.size() + tables[b].relations.id.size();
+				sum += tables[b].ways.refs.size();
+			}
+		}
+		report(threads[t] == 1 ? "columns" : "columns, all cores", now() - start, count, "objects");
+	}
+
+	std::cout << "checksum: " << sum << "\n";
+	return 0;
+}
@@ -0,0 +1,101 @@
+#include <iostream>
+#include <stdlib.h>
+#include <sys/stat.h>
+
+#include "libosmpbf.h"
+#include "bench.h"
+
+// Reads a whole file through PbfStream and visits every object, the way a
+// typical pass over a file does. Passes after the first read the file from
+// the page cache, so they leave out the disk. The same visit is then timed
+// over a column sidecar of the file, which takes a pass to write.
+
+using namespace libosmpbf;
+
+// works on PbfBlock and ColumnBlock alike, both of which are cheap to copy
+template <typename Block>
+static void visit(Block block, uint64_t &objects, uint64_t &sum){
+	for (typename Block::NodeIterator i = block.nodesBegin(); i != block.nodesEnd(); i.next(), objects++)
+		sum += (*i).id() + (*i).tags();
+	for (typename Block::WayIterator i = block.waysBegin(); i != block.waysEnd(); i.next(), objects++)
+		sum += (*i).id() + (*i).nodes();
+	for (typename Block::RelationIterator i = block.relationsBegin(); i != block.relationsEnd(); i.next(), objects++)
+		sum += (*i).id() + (*i).members();
+}
+
+int main(int argc, char *argv[]){
+
+	if (argc < 2 || argc > 3){
+		std::cout << "Usage: " << argv[0] << " [FILE] [PASSES]\n";
+		return 0;
+	}
+
+	int passes = argc == 3 ? atoi(argv[2]) : 3;
+
+	struct stat st;
+	if (stat(argv[1], &st) != 0){
+		std::cout << "Unable to read " << argv[1] << "\n";
+		return 1;
+	}
+
+	for (int pass = 0; pass < passes; pass++){
+
+		uint64_t objects = 0, sum = 0;
+		double start = now();
+
+		PbfStream pbf(argv[1]);
+		pbf.setReadAhead(4);
+		PbfBlock block;
+		while (pbf >> block)
+			visit(block, objects, sum);
+
+		if (pbf.bad()){
+			std::cout << "Unable to read " << argv[1] << "\n";
+			return 1;
+		}
+
+		report("pass " + std::to_string(pass+1), now() - start, objects, "objects", st.st_size);
+		if (sum == 0)
+			std::cout << "no objects\n";
+
+		// where the time went, when the library keeps track of it
+		if (PbfStats::enabled()){
+			pbf.stats().json(std::cout);
+			std::cout << "\n";
+		}
+	}
+
+	std::string sidecar = std::string(argv[1]) + ".cols";
+	{
+		double start = now();
+		PbfStream pbf(argv[1]);
+		ColumnWriter writer(sidecar.c_str(), argv[1]);
+		PbfBlock block;
+		while (pbf >> block)
+			writer << block;
+		if (!writer.finish()){
+			std::cout << "Unable to write " << sidecar << "\n";
+			return 1;
+		}
+		report("sidecar write", now() - start, 0, "", st.st_size);
+	}
+
+	for (int pass = 0; pass < passes; pass++){
+		uint64_t objects = 0, sum = 0;
+		double start = now();
+
+		ColumnFile columns(sidecar.c_str(), argv[1]);
+		if (!columns){
+			std::cout << "Unable to read " << sidecar << "\n";
+			return 1;
+		}
+		for (size_t b = 0; b < columns.blocks(); b++)
+			visit(columns.block(b), objects, sum);
+
+		report("sidecar pass " + std::to_string(pass+1), now() - start, objects, "objects", st.st_size);
+		if (sum == 0)
+			std::cout << "no objects\n";
+	}
+
+	return 0;
+}
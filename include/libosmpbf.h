@@ -29,12 +29,21 @@ SOFTWARE.
 #include <fstream>
 #include <list>
 #include <map>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <type_traits>
 #include <stdint.h>
 
 namespace OSMPBF {
 	class Blob;
+	class BlobHeader;
+	class DenseNodes;
+	class Info;
 	class Node;
 	class PrimitiveBlock;
+	class PrimitiveGroup;
 	class Relation;
 	class Way;
 }
@@ -49,34 +58,130 @@ class BlockRelation;
 class Node;
 class Way;
 class Relation;
-
-class OPbfStream : public std::ostream {
+class BlockIndex;
+class BlockCache;
+class BlockBuilder;
+class OsmChange;
+class ChangeStream;
+class ReadAhead;
+class SpanSource;
+class ColumnFile;
+class WorkerPool;
+class PbfSorter;
+
+// Writes PBF files. The file header is written on construction; sorted
+// marks the file as ordered by type then id, which readers may rely on.
+class OPbfStream : public std::ofstream {
 public:
-	OPbfStream(const char *file);
+	OPbfStream(const char *file, bool sorted = false);
 	~OPbfStream();
 
 	std::ostream &operator << (PbfBlock &block);
 
 private:
+
+	std::ostream &writeBlob(const std::string &type, const std::string &data);
 };
 
+// Counters describing where a PbfStream spends its time. They are only kept
+// when the library is built with LIBOSMPBF_STATS defined, as with
+// "make CFLAGS=-DLIBOSMPBF_STATS"; otherwise they stay zero and the read path
+// does no extra work at all.
+struct PbfStats {
+	PbfStats();
+
+	// nanoseconds spent reading the file, inflating blobs, parsing blocks,
+	// and in the caller between one block being returned and the next one
+	// being asked for
+	uint64_t readNs, inflateNs, parseNs, userNs;
+
+	uint64_t bytesRead, bytesInflated;
+	uint64_t blocks, cacheHits;
+	uint64_t nodes, ways, relations;
+
+	// heap allocations made for the reader's own buffers
+	uint64_t allocations;
+
+	// blobs the read-ahead had ready each time one was taken, summed, and
+	// how many times it had none and the reader had to wait
+	uint64_t queued, stalls;
+
+	// whether the library was built to keep the counters
+	static bool enabled();
+
+	void json(std::ostream &out) const;
+};
+
+// Reads PBF files block by block. Besides files named by path, blocks can
+// be read from a file descriptor such as a pipe or stdin, and from a span of
+// memory, which has to outlive the stream. Blobs in a span are inflated
+// straight from it, without being copied first. Only streams opened by
+// path are is_open() and read ahead.
 class PbfStream : public std::fstream {
 public:
 	PbfStream(const char *file);
+	PbfStream(int fd);
+	PbfStream(const char *data, size_t size);
 	~PbfStream();
 
 	std::fstream &operator >> (PbfBlock &block);
 
 	std::fstream &skipBlocks(unsigned long n);
 
+	// decoded blocks are looked up in and added to the given cache, which
+	// may be shared with other streams and threads. NULL disables caching.
+	// Only regular files are cached; memory spans and pipes never are.
+	void setCache(BlockCache *cache);
+
+	// how many blobs are read ahead of the one being decoded, on a thread
+	// of their own; 0 reads each blob only when it is asked for. Reading
+	// ahead costs a thread and a second descriptor, so it is off by default;
+	// it pays off for whole files read front to back. It restarts wherever
+	// the stream is seeked to.
+	void setReadAhead(unsigned blobs);
+
+	const PbfStats &stats() const;
+	void resetStats();
+
 private:
 
+	void init();
+	void readHeaderBlock();
+
 	std::fstream &readDataStr(std::fstream &in, std::string &str, size_t size);
-	std::fstream &readBlob(std::fstream &in, OSMPBF::Blob &blob);
-	bool inflate(std::string data, unsigned char *buf, size_t bufSz);
 
 	template <typename T>
-	bool getCompressedBlock(OSMPBF::Blob &blob, T &block);
+	bool readMessage(std::fstream &in, T &message, size_t size);
+
+	std::fstream &readBlobHeader(std::fstream &in, OSMPBF::BlobHeader &blobHeader);
+	bool readBlobBytes(size_t size, std::string &buffer, const char *&data);
+	bool readAheadBlob(uint64_t offset, std::string &data);
+	bool inflate(const char *data, size_t size, unsigned char *buf, size_t bufSz);
+
+	template <typename T>
+	bool readBlock(const char *data, size_t size, T &block);
+
+	BlockCache *cache;
+
+	// what is read instead of the file when the stream was not opened by
+	// path; span is set when it is memory that blobs are inflated from
+	std::unique_ptr<std::streambuf> source;
+	SpanSource *span;
+
+	std::string path;
+	unsigned readAheadBlobs;
+	std::unique_ptr<ReadAhead> readAhead;
+
+	// identifies the file to the cache: device, inode, modification time
+	// in seconds and nanoseconds, and size. Streams that are not identified
+	// are never cached.
+	uint64_t fileId[5];
+	bool identified;
+
+	PbfStats counters;
+
+	// when the last block was returned, to tell how long the caller spent
+	uint64_t returned;
 
 };
 
@@ -91,12 +196,35 @@ struct Coords {
 public:
 
 	// constructs floating-point latitude and longitude using the integer
-	// values stored in PBF and the relevant granularity
-	Coords(int64_t lat, int64_t lon, int32_t granularity);
+	// values stored in PBF and the relevant granularity and offsets, as
+	// (offset + granularity*value) nanodegrees
+	Coords(int64_t lat, int64_t lon, int32_t granularity, int64_t latOffset = 0, int64_t lonOffset = 0);
 	Coords();
 	double lat, lon;
 };
 
+// metadata tied to PrimitiveBlock; version is -1 when the object has none
+struct BlockInfo {
+	BlockInfo(int32_t version, int64_t timestamp, int64_t changeset, int32_t uid, const std::string &user);
+	int32_t version;
+	int64_t timestamp; // seconds since the epoch
+	int64_t changeset;
+	int32_t uid;
+	const std::string &user;
+};
+
+// Metadata describing the last edit of an object. Files written without
+// metadata leave version at -1.
+struct Info {
+	Info();
+	Info(const BlockInfo &info);
+	int32_t version;
+	int64_t timestamp; // seconds since the epoch
+	int64_t changeset;
+	int32_t uid;
+	std::string user;
+};
+
 // This structure holds a copy of data contained within a BlockNode that is
 // not tied to the data structure on disk, and can persist after the PrimitiveBlock
 // is no longer valid
@@ -106,28 +234,62 @@ struct Node {
 	uint64_t id;
 	Coords coords;
 	std::map<std::string, std::string> tags;
+	Info info;
 };
 
 class BlockNode {
 public:
-	BlockNode(const OSMPBF::PrimitiveBlock &b, int group, int i, uint64_t idBase, uint64_t node, int64_t lat, int64_t lon);
+	// for dense nodes, i is the position of the node's tags in keys_vals and
+	// node its position in the other columns. Those columns are delta coded,
+	// so id, lat, lon, timestamp, changeset, uid and userSid are the values
+	// already summed up to this node.
+	BlockNode(const OSMPBF::PrimitiveBlock &b, int group, int i, uint64_t id, uint64_t node, int64_t lat, int64_t lon,
+		int64_t timestamp, int64_t changeset, int32_t uid, int32_t userSid);
 	BlockNode(const OSMPBF::PrimitiveBlock &b, int group, int i);
 
 	uint64_t id() const;
 	int tags() const;
 	BlockTag tags(int x) const;
 	Coords coords() const;
+	BlockInfo info() const;
 
 	Node clone() const;
 
 private:
 	const OSMPBF::PrimitiveBlock &block;
 	int group, i, node;
-	uint64_t idBase;
+	uint64_t nodeId;
 	bool dense;
 	int64_t lat, lon;
+	int64_t timestamp, changeset;
+	int32_t uid, userSid;
 };
 
+inline BlockNode::BlockNode(const OSMPBF::PrimitiveBlock &b, int group, int i, uint64_t id, uint64_t node, int64_t lat, int64_t lon,
+		int64_t timestamp, int64_t changeset, int32_t uid, int32_t userSid) : block(b){
+	this->dense = true;
+	this->group = group;
+	this->i = i;
+	this->nodeId = id;
+	this->node = node;
+	this->lat = lat;
+	this->lon = lon;
+	this->timestamp = timestamp;
+	this->changeset = changeset;
+	this->uid = uid;
+	this->userSid = userSid;
+}
+
+inline BlockNode::BlockNode(const OSMPBF::PrimitiveBlock &b, int group, int i) : block(b){
+	this->dense = false;
+	this->group = group;
+	this->i = i;
+	this->nodeId = 0;
+	this->node = 0;
+	this->timestamp = this->changeset = 0;
+	this->uid = this->userSid = 0;
+}
+
 struct Way {
 	Way();
 	Way(const BlockWay &w);
@@ -135,6 +297,7 @@ struct Way {
 	std::list<uint64_t> nodeIds;
 	std::map<std::string, std::string> tags;
 	std::list<Node> nodes;
+	Info info;
 };
 
 class BlockWay {
@@ -145,7 +308,13 @@ public:
 	int tags() const;
 	BlockTag tags(int i) const;
 	int nodes() const;
+
+	// refs are delta coded, so each of these sums the refs up to i; refs()
+	// decodes them all in one go
 	uint64_t nodes(int i) const;
+	size_t refs(std::vector<uint64_t> &ids) const;
+
+	BlockInfo info() const;
 
 	Way clone() const;
 
@@ -154,6 +323,10 @@ private:
 	const OSMPBF::PrimitiveBlock &block;
 };
 
+inline BlockWay::BlockWay(const OSMPBF::Way &w, const OSMPBF::PrimitiveBlock &b) : way(w), block(b){
+
+}
+
 enum MemberType {
 	Member_Node = 0,
 	Member_Way = 1,
@@ -176,6 +349,7 @@ struct Relation {
 	uint64_t id;
 	MemberList members;
 	std::map<std::string, std::string> tags;
+	Info info;
 
 	const char *getTag(const char *name) const;
 };
@@ -197,6 +371,7 @@ public:
 	BlockTag tags(int i) const;
 	int members() const;
 	Member members(int i) const;
+	BlockInfo info() const;
 
 	Relation clone() const;
 
@@ -205,6 +380,210 @@ private:
 	const OSMPBF::PrimitiveBlock &block;
 };
 
+inline BlockRelation::BlockRelation(const OSMPBF::Relation &r, const OSMPBF::PrimitiveBlock &b) : relation(r), block(b){
+
+}
+
+// The columns of a DenseNodes group as they are stored, delta coded. The
+// DenseInfo columns are NULL unless every node has metadata, and keysVals
+// is NULL when no node is tagged.
+struct DenseColumns {
+	int count;
+	const int64_t *id, *lat, *lon;
+	const int32_t *keysVals;
+	int keysValsSize;
+	const int32_t *version;
+	const int64_t *timestamp, *changeset;
+	const int32_t *uid, *userSid;
+};
+
+// Walks the nodes of a DenseNodes group in order. The columns are delta
+// coded, so the cursor keeps running sums of them, DenseInfo included, and
+// the position of each node's tags in keys_vals. The walk is driven by the
+// id column, as keys_vals is left empty when none of the nodes are tagged
+// and DenseInfo may be missing altogether. lat and lon are in units of the
+// block's granularity, without its offsets.
+//
+// It works on plain arrays and is defined here, so that apply() can walk a
+// block in code compiled into the caller.
+class DenseCursor {
+public:
+	// columns summed besides id; callers that need fewer skip the rest
+	enum Fields {
+		Coords = 1,
+		Info = 2,
+		Tags = 4,
+		All = Coords | Info | Tags
+	};
+
+	DenseCursor(const DenseColumns &columns, int fields = All);
+	DenseCursor(const OSMPBF::DenseNodes &dense, int fields = All);
+
+	// moves to the next node, which for a new cursor is the first; false
+	// once there are no more
+	bool next();
+
+	// tag pairs of the current node, which start at keysVals[kv]
+	int tags() const;
+
+	DenseColumns columns;
+
+	// nodes in the group, and whether the DenseInfo and keys_vals columns
+	// are there and wanted
+	int count;
+	bool hasInfo, tagged;
+
+	// position of the current node in the columns, and of its tags in
+	// keys_vals
+	int node, kv;
+
+	int64_t id, lat, lon;
+	int64_t timestamp, changeset;
+	int32_t uid, userSid;
+
+private:
+	int fields;
+};
+
+inline DenseCursor::DenseCursor(const DenseColumns &columns, int fields) : columns(columns){
+	this->fields = fields;
+	this->count = columns.count;
+	this->hasInfo = (fields & Info) && columns.version != NULL;
+	this->tagged = (fields & Tags) && columns.keysValsSize > 0;
+	this->node = -1;
+	this->kv = 0;
+	this->id = this->lat = this->lon = 0;
+	this->timestamp = this->changeset = 0;
+	this->uid = this->userSid = 0;
+}
+
+inline bool DenseCursor::next(){
+	const DenseColumns &c = this->columns;
+
+	// skip the tags of the current node and their delimiter
+	if (this->tagged && this->node >= 0){
+		while (this->kv < c.keysValsSize && c.keysVals[this->kv] != 0)
+			this->kv += 2;
+		this->kv++;
+	}
+
+	if (++this->node >= this->count)
+		return false;
+
+	this->id += c.id[this->node];
+	if (this->fields & Coords){
+		this->lat += c.lat[this->node];
+		this->lon += c.lon[this->node];
+	}
+	if (this->hasInfo){
+		this->timestamp += c.timestamp[this->node];
+		this->changeset += c.changeset[this->node];
+		this->uid += c.uid[this->node];
+		this->userSid += c.userSid[this->node];
+	}
+	return true;
+}
+
+inline int DenseCursor::tags() const {
+	int n = 0;
+	if (this->tagged){
+		const DenseColumns &c = this->columns;
+		for (int t = this->kv; t + 1 < c.keysValsSize && c.keysVals[t] != 0; t += 2)
+			n++;
+	}
+	return n;
+}
+
+// The objects of one group of a block, reached without the generated
+// protobuf types, for apply().
+struct BlockGroup {
+	const OSMPBF::PrimitiveBlock *block;
+	int index;
+
+	DenseColumns dense;
+	int nodes;
+	int ways;
+	const OSMPBF::Way *const *way;
+	int relations;
+	const OSMPBF::Relation *const *relation;
+};
+
+// Metadata of dense nodes decoded column by column, with users as string
+// ids of the block. Nodes without metadata have a version of -1.
+struct DenseInfoColumns {
+	std::vector<uint64_t> id;
+	std::vector<int32_t> version;
+	std::vector<int64_t> timestamp; // seconds since the epoch
+	std::vector<int64_t> changeset;
+	std::vector<int32_t> uid;
+	std::vector<uint32_t> userSid;
+
+	void clear();
+};
+
+// Tags of a column of objects as an Arrow list of key/value pairs: the tags
+// of object i are entries offsets[i] up to offsets[i+1] of keys and values,
+// which index the table's string dictionary.
+struct TagColumns {
+	std::vector<int32_t> offsets;
+	std::vector<int32_t> keys, values;
+
+	void clear();
+};
+
+// The objects of a block column by column, in buffers laid out as Arrow
+// arrays so they can be handed to a query engine through the Arrow C data
+// interface without copying: fixed width columns are the values buffers,
+// lists are int32 offsets, one more than there are objects, into a child
+// column, and strings are dictionary encoded against strings, an Arrow
+// utf8 array of the block's string table.
+struct BlockColumns {
+	std::vector<int32_t> stringOffsets;
+	std::vector<char> strings;
+
+	struct Nodes {
+		std::vector<uint64_t> id;
+		std::vector<double> lat, lon;
+		TagColumns tags;
+	} nodes;
+
+	struct Ways {
+		std::vector<uint64_t> id;
+		std::vector<int32_t> refOffsets;
+		std::vector<uint64_t> refs;
+		TagColumns tags;
+	} ways;
+
+	// member types are MemberType values, and roles index strings
+	struct Relations {
+		std::vector<uint64_t> id;
+		std::vector<int32_t> memberOffsets;
+		std::vector<uint64_t> memberIds;
+		std::vector<int8_t> memberTypes;
+		std::vector<int32_t> memberRoles;
+		TagColumns tags;
+	} relations;
+
+	// empties the columns, keeping their buffers for the next block
+	void clear();
+};
+
+// Converts batches of blocks into columns on threads that are started once
+// and kept for every batch.
+class ColumnConverter {
+public:
+	// threads counts the caller; 0 uses one per core
+	ColumnConverter(unsigned threads = 0);
+	~ColumnConverter();
+
+	// converts each of blocks into the table at the same position of
+	// tables, each thread taking the next block left
+	void convert(const std::vector<PbfBlock> &blocks, std::vector<BlockColumns> &tables);
+
+private:
+	std::unique_ptr<WorkerPool> workers;
+};
+
 class PbfBlock {
 public:
 
@@ -213,7 +592,9 @@ public:
 
 	class NodeIterator {
 	public:
-		NodeIterator(OSMPBF::PrimitiveBlock &b, bool end);
+		NodeIterator(const OSMPBF::PrimitiveBlock &b, bool end);
+		NodeIterator(const NodeIterator &i);
+		~NodeIterator();
 
 		bool hasData() const;
 
@@ -226,16 +607,24 @@ public:
 		const BlockNode operator * () const;
 
 	private:
-		OSMPBF::PrimitiveBlock &block;
-		int group, i, node;
-		uint64_t idBase;
+		void startGroup();
+
+		const OSMPBF::PrimitiveBlock &block;
+
+		// walks the DenseNodes of the current group while iterating over
+		// them, keeping running sums so each step only adds one delta to
+		// each column
+		std::unique_ptr<DenseCursor> cursor;
+
+		// node is the position within the current group's dense columns or
+		// plain nodes, of which there are count
+		int group, node, count;
 		bool dense, end;
-		int64_t lat, lon;
 	};
 
 	class WayIterator {
 	public:
-		WayIterator(OSMPBF::PrimitiveBlock &b, bool end);
+		WayIterator(const OSMPBF::PrimitiveBlock &b, bool end);
 
 		bool hasData() const;
 		bool operator == (const WayIterator &i) const;
@@ -247,14 +636,14 @@ public:
 		const BlockWay operator * () const;
 
 	private:
-		OSMPBF::PrimitiveBlock &block;
+		const OSMPBF::PrimitiveBlock &block;
 		int group, i;
 		bool end;
 	};
 
 	class RelationIterator {
 	public:
-		RelationIterator(OSMPBF::PrimitiveBlock &b, bool end);
+		RelationIterator(const OSMPBF::PrimitiveBlock &b, bool end);
 
 		bool hasData() const;
 
@@ -267,13 +656,29 @@ public:
 		const BlockRelation operator * () const;
 
 	private:
-		OSMPBF::PrimitiveBlock &block;
+		const OSMPBF::PrimitiveBlock &block;
 		int group, i;
 		bool end;
 	};
 
 	int granularity() const;
 
+	// entry sid of the block's string table
+	const std::string &string(uint32_t sid) const;
+
+	// decodes the metadata of every node in the block's DenseNodes groups
+	// at once, in the order NodeIterator visits them. Returns the number
+	// of nodes.
+	size_t denseInfo(DenseInfoColumns &columns) const;
+
+	// decodes every object of the block into columns at once, nodes in
+	// the order NodeIterator visits them. Returns the number of objects.
+	size_t columns(BlockColumns &columns) const;
+
+	// the groups of the block, which apply() walks one by one
+	int groups() const;
+	void group(int g, BlockGroup &group) const;
+
 	int Nodes() const;
 	NodeIterator nodesBegin();
 	NodeIterator nodesEnd();
@@ -287,8 +692,648 @@ public:
 private:
 
 	friend std::fstream &PbfStream::operator >> (PbfBlock &block);
-	OSMPBF::PrimitiveBlock *block;
+	friend std::ostream &OPbfStream::operator << (PbfBlock &block);
+	friend class BlockIndex;
+	friend class BlockBuilder;
+	friend class ChangeStream;
+	friend class PbfSorter;
+
+	// shared with BlockCache when caching is enabled, so the decoded data
+	// is never modified while another owner holds it
+	std::shared_ptr<OSMPBF::PrimitiveBlock> block;
+
+};
+
+// Which of the node, way and relation callbacks a handler has, found at
+// compile time.
+template <typename Handler>
+struct HandlerCallbacks {
+	template <typename H> static char testNode(decltype(std::declval<H&>().node(std::declval<const BlockNode&>()), 0));
+	template <typename H> static long testNode(...);
+	template <typename H> static char testWay(decltype(std::declval<H&>().way(std::declval<const BlockWay&>()), 0));
+	template <typename H> static long testWay(...);
+	template <typename H> static char testRelation(decltype(std::declval<H&>().relation(std::declval<const BlockRelation&>()), 0));
+	template <typename H> static long testRelation(...);
+
+	static const bool nodes = sizeof(testNode<Handler>(0)) == 1;
+	static const bool ways = sizeof(testWay<Handler>(0)) == 1;
+	static const bool relations = sizeof(testRelation<Handler>(0)) == 1;
+};
+
+// Walks a group for apply(), calling the handler's callbacks directly so
+// they can be inlined into the walk. The objects of a callback the handler
+// does not have are passed over without decoding, and the call to it is
+// never instantiated.
+template <typename Handler>
+struct GroupWalk {
+	typedef HandlerCallbacks<Handler> Callbacks;
+
+	static void walk(const BlockGroup &group, Handler &handler){
+		nodes(group, handler, std::integral_constant<bool, Callbacks::nodes>());
+		ways(group, handler, std::integral_constant<bool, Callbacks::ways>());
+		relations(group, handler, std::integral_constant<bool, Callbacks::relations>());
+	}
+
+	static void nodes(const BlockGroup &group, Handler &handler, std::true_type){
+		DenseCursor c(group.dense);
+		while (c.next())
+			handler.node(BlockNode(*group.block, group.index, c.kv, c.id, c.node, c.lat, c.lon,
+				c.timestamp, c.changeset, c.uid, c.userSid));
+
+		for (int n = 0; n < group.nodes; n++)
+			handler.node(BlockNode(*group.block, group.index, n));
+	}
+
+	static void ways(const BlockGroup &group, Handler &handler, std::true_type){
+		for (int w = 0; w < group.ways; w++)
+			handler.way(BlockWay(*group.way[w], *group.block));
+	}
+
+	static void relations(const BlockGroup &group, Handler &handler, std::true_type){
+		for (int r = 0; r < group.relations; r++)
+			handler.relation(BlockRelation(*group.relation[r], *group.block));
+	}
+
+	static void nodes(const BlockGroup &, Handler &, std::false_type){}
+	static void ways(const BlockGroup &, Handler &, std::false_type){}
+	static void relations(const BlockGroup &, Handler &, std::false_type){}
+};
+
+// Hands the objects of block to handler, which has any of
+//   void node(const BlockNode &node);
+//   void way(const BlockWay &way);
+//   void relation(const BlockRelation &relation);
+// in a single walk over the block's groups, in the order they are stored.
+template <typename Handler>
+void apply(const PbfBlock &block, Handler &handler){
+	BlockGroup group;
+	for (int g = 0, groups = block.groups(); g < groups; g++){
+		block.group(g, group);
+		GroupWalk<Handler>::walk(group, handler);
+	}
+}
+
+// Writes the blocks of a PBF file as BlockColumns to a sidecar file, during
+// a first pass that reads them anyway, so that later passes can map the
+// sidecar with ColumnFile instead of inflating and parsing again. The
+// columns are stored as they are in memory, in host byte order, and the
+// file is only complete once finish() has run, which the destructor does.
+class ColumnWriter : public std::ofstream {
+public:
+	// source is the PBF file the blocks come from, which ColumnFile checks
+	// the sidecar against
+	ColumnWriter(const char *file, const char *source);
+	~ColumnWriter();
+
+	std::ostream &operator << (const PbfBlock &block);
+	std::ostream &operator << (const BlockColumns &columns);
+
+	bool finish();
+
+private:
+	void writeArray(const void *data, size_t size);
+
+	uint64_t sourceId[5];
+	std::vector<uint64_t> offsets;
+	BlockColumns columns;
+	bool finished;
+};
+
+// One block of a ColumnFile, iterated like a PbfBlock. Tags and roles are
+// the same strings, but coordinates and ids are read straight from the
+// mapped columns without any decoding.
+class ColumnBlock {
+public:
+
+	class Node {
+	public:
+		Node(const ColumnBlock &b, size_t i);
+		uint64_t id() const;
+		Coords coords() const;
+		int tags() const;
+		BlockTag tags(int i) const;
+	private:
+		const ColumnBlock &block;
+		size_t i;
+	};
+
+	class Way {
+	public:
+		Way(const ColumnBlock &b, size_t i);
+		uint64_t id() const;
+		int tags() const;
+		BlockTag tags(int i) const;
+		int nodes() const;
+		uint64_t nodes(int n) const;
+	private:
+		const ColumnBlock &block;
+		size_t i;
+	};
+
+	class Relation {
+	public:
+		Relation(const ColumnBlock &b, size_t i);
+		uint64_t id() const;
+		int tags() const;
+		BlockTag tags(int i) const;
+		int members() const;
+		BlockRelation::Member members(int m) const;
+	private:
+		const ColumnBlock &block;
+		size_t i;
+	};
+
+	// one iterator type serves all three; T is Node, Way or Relation
+	template <typename T>
+	class Iterator {
+	public:
+		Iterator(const ColumnBlock &b, size_t i) : block(b), i(i){}
+
+		bool operator == (const Iterator &o) const {return i == o.i;}
+		bool operator != (const Iterator &o) const {return i != o.i;}
+
+		Iterator &next(){i++; return *this;}
+
+		// objects are made on the fly, so -> hands out a temporary one
+		struct Pointer {
+			T object;
+			const T *operator -> () const {return &object;}
+		};
+
+		Pointer operator -> () const {Pointer p = {T(block, i)}; return p;}
+		const T operator * () const {return T(block, i);}
+
+	private:
+		const ColumnBlock &block;
+		size_t i;
+	};
+
+	typedef Iterator<Node> NodeIterator;
+	typedef Iterator<Way> WayIterator;
+	typedef Iterator<Relation> RelationIterator;
+
+	ColumnBlock();
+
+	const std::string &string(uint32_t sid) const;
+
+	size_t Nodes() const;
+	NodeIterator nodesBegin() const;
+	NodeIterator nodesEnd() const;
+	size_t Ways() const;
+	WayIterator waysBegin() const;
+	WayIterator waysEnd() const;
+	size_t Relations() const;
+	RelationIterator relationsBegin() const;
+	RelationIterator relationsEnd() const;
+
+	// the arrays in the order ColumnWriter stores them, which is the order
+	// of the vectors of BlockColumns
+	enum Array {
+		StringOffsets, Strings,
+		NodeIds, NodeLats, NodeLons, NodeTagOffsets, NodeTagKeys, NodeTagValues,
+		WayIds, WayRefOffsets, WayRefs, WayTagOffsets, WayTagKeys, WayTagValues,
+		RelationIds, RelationMemberOffsets, RelationMemberIds, RelationMemberTypes, RelationMemberRoles,
+		RelationTagOffsets, RelationTagKeys, RelationTagValues,
+		Arrays
+	};
+
+	// the mapped array and its number of elements, for reading whole
+	// columns at once
+	template <typename T>
+	const T *array(Array a) const {return (const T*)arrays[a];}
+	size_t size(Array a) const;
+
+private:
+	friend class ColumnFile;
+
+	BlockTag tag(Array offsets, Array keys, Array values, size_t i, int t) const;
+
+	const char *arrays[Arrays];
+	const uint64_t *sizes;
+
+	// the block's string table, made into strings once per block
+	std::shared_ptr<std::vector<std::string> > strings;
+};
+
+// A sidecar written by ColumnWriter, mapped into memory. When source is
+// given, the file is only used if it was written from that PBF file as it
+// is now; otherwise the ColumnFile is false and the PBF has to be read.
+class ColumnFile {
+public:
+	ColumnFile(const char *file, const char *source = NULL);
+	~ColumnFile();
+
+	operator bool () const;
+
+	size_t blocks() const;
+	ColumnBlock block(size_t i) const;
+
+private:
+	const char *data;
+	size_t length;
+	const uint64_t *offsets;
+	size_t count;
+};
+
+// Where nodes are, looked up many at a time for the refs of a way.
+class LocationLookup {
+public:
+	virtual ~LocationLookup();
+
+	// sets lat[i] and lon[i] to the location of node ids[i], or to NaN when
+	// it is not known. Returns how many were found.
+	virtual size_t locations(const uint64_t *ids, size_t n, double *lat, double *lon) const = 0;
+};
+
+// Node locations held in memory as columns sorted by id, typically filled
+// by a pass over the nodes of a file before its ways are read. Adding nodes
+// out of order is allowed, and they are sorted before the next lookup.
+class NodeLocations : public LocationLookup {
+public:
+	NodeLocations();
+
+	void add(uint64_t id, const Coords &coords);
+	void add(const PbfBlock &block);
+
+	size_t size() const;
+	void clear();
+
+	size_t locations(const uint64_t *ids, size_t n, double *lat, double *lon) const;
+
+private:
+	mutable std::mutex mutex;
+	mutable std::vector<uint64_t> ids;
+	mutable std::vector<double> lats, lons;
+	mutable bool sorted;
+};
+
+// Bounding box, length and area of a way, from the locations of its nodes.
+// Nodes without a location are left out and counted in missing; the box
+// is NaN when none had one.
+struct WayGeometry {
+	WayGeometry();
+
+	double minLat, minLon, maxLat, maxLon;
+	double length; // metres along the way
+	double area; // square metres enclosed by a closed way, 0 otherwise
+	uint32_t missing;
+
+	// geometry of the n points lat[i], lon[i], in order; the arrays are
+	// read column by column so the loops can be vectorized
+	void compute(const double *lat, const double *lon, size_t n, bool closed);
+};
+
+// Computes the geometry of ways from their ref spans and a LocationLookup,
+// keeping its buffers of refs and locations from one way to the next.
+class GeometryBuilder {
+public:
+	// threads is how many block() shares ways out between, counting the
+	// caller; 0 uses one per core. They are started by the first call to
+	// block() and kept for the ones after it.
+	GeometryBuilder(const LocationLookup &locations, unsigned threads = 0);
+	~GeometryBuilder();
+
+	WayGeometry way(const BlockWay &way);
+
+	// every way of block in the order WayIterator visits them
+	void block(const PbfBlock &block, std::vector<WayGeometry> &ways);
+
+private:
+	const LocationLookup &locations;
+	std::vector<uint64_t> refs;
+	std::vector<double> lat, lon;
+
+	unsigned threads;
+	std::unique_ptr<WorkerPool> workers;
+
+	// the ways of the block being built, and a builder with buffers of its
+	// own for each of the pool's threads but the caller's
+	std::vector<BlockWay> ways;
+	std::vector<std::unique_ptr<GeometryBuilder> > builders;
+};
+
+// Position of a data block within a PBF file, along with the range of ids
+// of each object type the block contains. Ranges are indexed by MemberType.
+struct BlockIndexEntry {
+	BlockIndexEntry();
+	uint64_t offset;
+	uint64_t minId[3], maxId[3];
+
+	bool has(MemberType type) const;
+
+	// widens the ranges to cover every object in b
+	void add(const OSMPBF::PrimitiveBlock &b);
+};
+
+// Index of the id ranges held by each block of a PBF file. Building it
+// requires one full pass over the file, so it can be saved alongside the
+// file and loaded again later.
+class BlockIndex {
+public:
+	BlockIndex();
+
+	bool build(const char *file);
+	bool load(const char *file);
+	bool save(const char *file) const;
+
+	size_t blocks() const;
+	const BlockIndexEntry &block(size_t i) const;
+
+	// appends the indexes of all blocks whose id range for the given type
+	// includes id. Ranges are disjoint in sorted files, so there is usually
+	// at most one.
+	void find(MemberType type, uint64_t id, std::vector<size_t> &blocks) const;
+
+private:
+	void sort();
+
+	std::vector<BlockIndexEntry> entries;
+
+	// for each type, indexes of the blocks containing it ordered by minId,
+	// and the running maximum of maxId over that order
+	std::vector<size_t> order[3];
+	std::vector<uint64_t> reach[3];
+};
+
+// Random access to objects by id. Only the blocks which may contain the
+// requested ids are decoded, and recently used blocks are kept decoded so
+// that nearby lookups do not pay for them again. Blocks which are not held
+// locally are taken from the shared cache when one is given.
+class IdLookup {
+public:
+	IdLookup(const char *file, const BlockIndex &index, size_t cacheBlocks = 16, BlockCache *cache = NULL);
+	~IdLookup();
+
+	bool node(uint64_t id, Node &node);
+	bool way(uint64_t id, Way &way);
+	bool relation(uint64_t id, Relation &relation);
+
+	// batch lookups; each needed block is decoded once for all of the ids
+	// it holds. Ids already in out are not looked up again. Returns the
+	// number of distinct ids that are in out afterwards, so a batch was
+	// found in full when that equals the number of distinct ids asked for.
+	size_t nodes(const std::vector<uint64_t> &ids, std::map<uint64_t, Node> &out);
+	size_t ways(const std::vector<uint64_t> &ids, std::map<uint64_t, Way> &out);
+	size_t relations(const std::vector<uint64_t> &ids, std::map<uint64_t, Relation> &out);
+
+	operator bool () const;
+
+private:
+	typedef std::list<std::pair<size_t, PbfBlock*> > BlockList;
+
+	PbfBlock *getBlock(size_t b);
+
+	template <typename T>
+	size_t lookup(MemberType type, const std::vector<uint64_t> &ids, std::map<uint64_t, T> &out);
+
+	PbfStream stream;
+	const BlockIndex &index;
+
+	// most recently used blocks at the front
+	size_t cacheBlocks;
+	BlockList lru;
+	std::map<size_t, BlockList::iterator> cached;
+};
+
+// Thread-safe cache of decoded blocks, keyed by file and block offset and
+// bounded by the memory used by the decoded blocks. Any number of PbfStreams
+// may share one cache, from any number of threads; blocks found in it skip
+// both inflate and parsing.
+class BlockCache {
+public:
+	BlockCache(size_t maxBytes);
+	~BlockCache();
+
+	uint64_t hits() const;
+	uint64_t misses() const;
+	uint64_t evictions() const;
+
+	size_t bytes() const;
+	size_t blocks() const;
+	size_t maxBytes() const;
+
+	void clear();
+
+private:
+	friend class PbfStream;
+
+	typedef std::shared_ptr<OSMPBF::PrimitiveBlock> BlockPtr;
+
+	struct Key {
+		uint64_t file[5];
+		uint64_t offset;
+		bool operator < (const Key &k) const;
+	};
+
+	struct Entry {
+		Key key;
+		BlockPtr block;
+		size_t bytes;
+	};
+
+	typedef std::list<Entry> EntryList;
+
+	BlockPtr get(const Key &key);
+	void put(const Key &key, const BlockPtr &block);
+	void evict(size_t bytes);
+
+	mutable std::mutex mutex;
+	size_t max, used;
+	uint64_t hitCount, missCount, evictCount;
+
+	// most recently used blocks at the front
+	EntryList lru;
+	std::map<Key, EntryList::iterator> entries;
+};
+
+// Assembles PrimitiveBlocks out of objects so they can be written with
+// OPbfStream. Nodes are stored as DenseNodes, and each run of objects of the
+// same type shares a PrimitiveGroup.
+class BlockBuilder {
+public:
+	// number of objects a block conventionally holds
+	static const size_t blockObjects = 8000;
+
+	BlockBuilder(int granularity = 100);
+	~BlockBuilder();
+
+	void add(const Node &node);
+	void add(const Way &way);
+	void add(const Relation &relation);
+
+	size_t objects() const;
+	bool full() const;
+
+	// moves the assembled block into block and starts a new one
+	void build(PbfBlock &block);
+	void clear();
+
+private:
+	friend class ChangeStream;
+
+	// metadata in the form stored in blocks, with the user as a string id
+	// of the block being built
+	struct Meta {
+		Meta();
+		int32_t version;
+		int64_t timestamp;
+		int64_t changeset;
+		int32_t uid;
+		uint32_t userSid;
+	};
+
+	static void setInfo(OSMPBF::Info &info, const Meta &meta);
+
+	uint32_t string(const std::string &s);
+	Meta meta(const Info &info);
+	OSMPBF::PrimitiveGroup &group(MemberType type);
+	void endGroup();
+	void packStrings();
+
+	// lat and lon are in nanodegrees; keysVals holds alternating key and
+	// value string ids of this block
+	void addNode(int64_t id, int64_t lat, int64_t lon, const std::vector<uint32_t> &keysVals, const Meta &meta);
+	OSMPBF::Way &addWay();
+	OSMPBF::Relation &addRelation();
+
+	std::unique_ptr<OSMPBF::PrimitiveBlock> block;
+	std::map<std::string, uint32_t> strings;
+	int granularity;
+	size_t count;
+	MemberType groupType;
+	bool hasGroup;
+
+	// running values for delta coding the current DenseNodes group
+	int64_t lastId, lastLat, lastLon, lastTimestamp, lastChangeset;
+	int32_t lastUid, lastUserSid;
+	bool denseMeta;
+};
+
+// Rewrites a PBF file in type then id order within a bound on memory.
+// Blocks are read until about maxBytes of them are held, and their objects
+// are sorted and written to tempDir as a run per type. The runs of each type
+// are then merged, all three types at once, into a file marked as sorted.
+// Blocks are rebuilt with BlockBuilder, so their string tables are packed.
+class PbfSorter {
+public:
+	PbfSorter(size_t maxBytes = 1024*1024*1024, const char *tempDir = "/tmp");
+
+	bool sort(const char *input, const char *output);
+
+	// how many runs the last sort wrote, 1 when it fit in memory
+	size_t runs() const;
+
+private:
+	struct Objects;
+
+	bool writeRun(Objects &objects);
+	bool merge(const char *output);
+	void removeFiles();
+
+	size_t maxBytes;
+	std::string tempDir;
+	size_t runCount;
+
+	// run files of each MemberType
+	std::vector<std::string> files[3];
+};
+
+// A set of changes read from OsmChange (.osc) files, ordered by type then id.
+// When an object is changed more than once, the last change wins.
+class OsmChange {
+public:
+	enum Action {
+		Create,
+		Modify,
+		Delete
+	};
+
+	template <typename T>
+	struct Change {
+		Action action;
+		T object;
+	};
+
+	typedef std::map<uint64_t, Change<Node> > NodeChanges;
+	typedef std::map<uint64_t, Change<Way> > WayChanges;
+	typedef std::map<uint64_t, Change<Relation> > RelationChanges;
+
+	OsmChange();
+
+	// reads a change file, which may be gzip compressed
+	bool load(const char *file);
+
+	void add(Action action, const Node &node);
+	void add(Action action, const Way &way);
+	void add(Action action, const Relation &relation);
+
+	const NodeChanges &nodes() const;
+	const WayChanges &ways() const;
+	const RelationChanges &relations() const;
+
+	size_t size() const;
+	void clear();
+
+private:
+	NodeChanges nodeChanges;
+	WayChanges wayChanges;
+	RelationChanges relationChanges;
+};
+
+// Applies an OsmChange to a PBF file sorted by type then id while it is
+// read, in a single pass over both. Blocks no change falls into are passed
+// through untouched; the others are rebuilt with the changes merged in, and
+// created objects that sort after the end of their type are given blocks of
+// their own.
+class ChangeStream {
+public:
+	ChangeStream(PbfStream &in, const OsmChange &changes);
+	~ChangeStream();
+
+	ChangeStream &operator >> (PbfBlock &block);
+
+	operator bool () const;
+	bool operator ! () const;
+
+private:
+	bool pending(MemberType type, uint64_t &id) const;
+	bool affects(const BlockIndexEntry &range) const;
+	void merge(const OSMPBF::PrimitiveBlock &b);
+	void flush(MemberType type);
+	void startType(MemberType type);
+	void emit(bool force);
+
+	// writes the changes which sort before id, and returns whether the
+	// object with id should be copied from the input
+	template <typename Changes>
+	bool advance(typename Changes::const_iterator &next, const Changes &all, uint64_t id);
+
+	void copyNodes(const OSMPBF::PrimitiveBlock &b, const OSMPBF::PrimitiveGroup &group);
+	void copyWay(const OSMPBF::PrimitiveBlock &b, const OSMPBF::Way &way);
+	void copyRelation(const OSMPBF::PrimitiveBlock &b, const OSMPBF::Relation &relation);
+	uint32_t remap(const OSMPBF::PrimitiveBlock &b, uint32_t sid);
+	BlockBuilder::Meta meta(const OSMPBF::PrimitiveBlock &b, const OSMPBF::Info &info);
+
+	template <typename T>
+	void write(const OsmChange::Change<T> &change);
+
+	PbfStream &in;
+	const OsmChange &changes;
+	bool ok, finished;
+
+	// type of the objects currently being read; changes to earlier types
+	// have all been written
+	MemberType current;
+
+	OsmChange::NodeChanges::const_iterator nextNode;
+	OsmChange::WayChanges::const_iterator nextWay;
+	OsmChange::RelationChanges::const_iterator nextRelation;
+
+	BlockBuilder builder;
+	std::list<PbfBlock> ready;
 
+	// string ids of the block being merged in the block being built
+	std::vector<uint32_t> strings;
 };
 
 } // end namespace
@@ -0,0 +1,363 @@
+#include <math.h>
+#include <algorithm>
+
+#include "protobuf/osm.pb.h"
+#include "libosmpbf.h"
+using namespace libosmpbf;
+
+// converts nanodegrees to units of granularity, rounding to the nearest
+static int64_t scale(int64_t nano, int granularity){
+	if (nano >= 0)
+		return (nano + granularity/2) / granularity;
+	else
+		return (nano - granularity/2) / granularity;
+}
+
+void BlockBuilder::setInfo(OSMPBF::Info &info, const Meta &meta){
+	info.set_version(meta.version);
+	info.set_timestamp(meta.timestamp);
+	info.set_changeset(meta.changeset);
+	info.set_uid(meta.uid);
+	info.set_user_sid(meta.userSid);
+}
+
+BlockBuilder::Meta::Meta(){
+	version = -1;
+	timestamp = changeset = 0;
+	uid = 0;
+	userSid = 0;
+}
+
+BlockBuilder::BlockBuilder(int granularity){
+	this->granularity = granularity;
+	clear();
+}
+
+BlockBuilder::~BlockBuilder(){
+
+}
+
+void BlockBuilder::clear(){
+	block.reset(new OSMPBF::PrimitiveBlock);
+	// string id 0 is reserved as the delimiter of DenseNodes keys_vals
+	block->mutable_stringtable()->add_s("");
+	if (granularity != 100)
+		block->set_granularity(granularity);
+
+	strings.clear();
+	count = 0;
+	hasGroup = false;
+}
+
+size_t BlockBuilder::objects() const {
+	return count;
+}
+
+bool BlockBuilder::full() const {
+	return count >= blockObjects;
+}
+
+void BlockBuilder::build(PbfBlock &out){
+	endGroup();
+	packStrings();
+	out.block.reset(block.release());
+	clear();
+}
+
+// string ids are stored as varints, so the strings used most are given the
+// smallest ids, which takes a byte off every use of them beyond the first
+// 127. Ties keep the order in which strings were first used.
+struct UseOrder {
+	UseOrder(const std::vector<uint64_t> &u) : uses(u){}
+	bool operator () (uint32_t a, uint32_t b) const {return uses[a] > uses[b];}
+	const std::vector<uint64_t> &uses;
+};
+
+template <typename T>
+static void countInfo(std::vector<uint64_t> &uses, const T &object){
+	if (object.has_info())
+		uses[object.info().user_sid()]++;
+}
+
+template <typename T>
+static void remapInfo(const std::vector<uint32_t> &sids, T &object){
+	if (object.has_info())
+		object.mutable_info()->set_user_sid(sids[object.info().user_sid()]);
+}
+
+template <typename T>
+static void countTags(std::vector<uint64_t> &uses, const T &object){
+	for (int k = 0; k < object.keys_size(); k++)
+		uses[object.keys(k)]++;
+	for (int v = 0; v < object.vals_size(); v++)
+		uses[object.vals(v)]++;
+}
+
+template <typename T>
+static void remapTags(const std::vector<uint32_t> &sids, T &object){
+	for (int k = 0; k < object.keys_size(); k++)
+		object.set_keys(k, sids[object.keys(k)]);
+	for (int v = 0; v < object.vals_size(); v++)
+		object.set_vals(v, sids[object.vals(v)]);
+}
+
+void BlockBuilder::packStrings(){
+	OSMPBF::StringTable &table = *block->mutable_stringtable();
+	size_t n = table.s_size();
+	if (n <= 2)
+		return;
+
+	std::vector<uint64_t> uses(n, 0);
+	for (int g = 0; g < block->primitivegroup_size(); g++){
+		const OSMPBF::PrimitiveGroup &group = block->primitivegroup(g);
+
+		const OSMPBF::DenseNodes &dense = group.dense();
+		for (int i = 0; i < dense.keys_vals_size(); i++)
+			uses[dense.keys_vals(i)]++;
+		DenseCursor c(dense, DenseCursor::Info);
+		while (c.hasInfo && c.next())
+			uses[c.userSid]++;
+
+		for (int i = 0; i < group.nodes_size(); i++){
+			countTags(uses, group.nodes(i));
+			countInfo(uses, group.nodes(i));
+		}
+		for (int i = 0; i < group.ways_size(); i++){
+			countTags(uses, group.ways(i));
+			countInfo(uses, group.ways(i));
+		}
+		for (int i = 0; i < group.relations_size(); i++){
+			const OSMPBF::Relation &relation = group.relations(i);
+			countTags(uses, relation);
+			countInfo(uses, relation);
+			for (int m = 0; m < relation.roles_sid_size(); m++)
+				uses[relation.roles_sid(m)]++;
+		}
+	}
+
+	// id 0 stays the empty delimiter
+	std::vector<uint32_t> order(n - 1);
+	for (size_t i = 1; i < n; i++)
+		order[i-1] = i;
+	std::stable_sort(order.begin(), order.end(), UseOrder(uses));
+
+	std::vector<uint32_t> sids(n);
+	sids[0] = 0;
+	bool moved = false;
+	for (size_t i = 0; i < order.size(); i++){
+		sids[order[i]] = i + 1;
+		moved = moved || order[i] != i + 1;
+	}
+	if (!moved)
+		return;
+
+	OSMPBF::StringTable packed;
+	packed.add_s("");
+	for (size_t i = 0; i < order.size(); i++)
+		packed.add_s()->swap(*table.mutable_s(order[i]));
+	table.Swap(&packed);
+
+	for (int g = 0; g < block->primitivegroup_size(); g++){
+		OSMPBF::PrimitiveGroup &group = *block->mutable_primitivegroup(g);
+
+		// mutable_dense() would add an empty DenseNodes to other groups
+		if (group.has_dense()){
+			OSMPBF::DenseNodes &dense = *group.mutable_dense();
+			for (int i = 0; i < dense.keys_vals_size(); i++)
+				dense.set_keys_vals(i, sids[dense.keys_vals(i)]);
+
+			// user sids are delta coded, so they are decoded, moved and
+			// coded again
+			OSMPBF::DenseInfo &info = *dense.mutable_denseinfo();
+			int32_t oldSid = 0, newSid = 0;
+			for (int i = 0; i < info.user_sid_size(); i++){
+				oldSid += info.user_sid(i);
+				int32_t sid = sids[oldSid];
+				info.set_user_sid(i, sid - newSid);
+				newSid = sid;
+			}
+		}
+
+		for (int i = 0; i < group.nodes_size(); i++){
+			remapTags(sids, *group.mutable_nodes(i));
+			remapInfo(sids, *group.mutable_nodes(i));
+		}
+		for (int i = 0; i < group.ways_size(); i++){
+			remapTags(sids, *group.mutable_ways(i));
+			remapInfo(sids, *group.mutable_ways(i));
+		}
+		for (int i = 0; i < group.relations_size(); i++){
+			OSMPBF::Relation &relation = *group.mutable_relations(i);
+			remapTags(sids, relation);
+			remapInfo(sids, relation);
+			for (int m = 0; m < relation.roles_sid_size(); m++)
+				relation.set_roles_sid(m, sids[relation.roles_sid(m)]);
+		}
+	}
+}
+
+uint32_t BlockBuilder::string(const std::string &s){
+	std::map<std::string, uint32_t>::iterator i = strings.find(s);
+	if (i != strings.end())
+		return i->second;
+
+	uint32_t sid = block->stringtable().s_size();
+	block->mutable_stringtable()->add_s(s);
+	strings.insert(std::make_pair(s, sid));
+	return sid;
+}
+
+BlockBuilder::Meta BlockBuilder::meta(const Info &info){
+	Meta m;
+	if (info.version != -1){
+		m.version = info.version;
+		m.timestamp = info.timestamp;
+		m.changeset = info.changeset;
+		m.uid = info.uid;
+		m.userSid = string(info.user);
+	}
+	return m;
+}
+
+OSMPBF::PrimitiveGroup &BlockBuilder::group(MemberType type){
+	if (!hasGroup || groupType != type){
+		endGroup();
+		block->add_primitivegroup();
+		groupType = type;
+		hasGroup = true;
+
+		lastId = lastLat = lastLon = lastTimestamp = lastChangeset = 0;
+		lastUid = lastUserSid = 0;
+		denseMeta = false;
+	}
+	return *block->mutable_primitivegroup(block->primitivegroup_size()-1);
+}
+
+// DenseNodes may leave out keys_vals entirely when none of its nodes are
+// tagged, which saves a delimiter per node
+void BlockBuilder::endGroup(){
+	if (!hasGroup || groupType != Member_Node)
+		return;
+
+	OSMPBF::DenseNodes &dense = *group(Member_Node).mutable_dense();
+	for (int n = 0; n < dense.keys_vals_size(); n++){
+		if (dense.keys_vals(n) != 0)
+			return;
+	}
+	dense.clear_keys_vals();
+}
+
+void BlockBuilder::addNode(int64_t id, int64_t lat, int64_t lon, const std::vector<uint32_t> &keysVals, const Meta &meta){
+
+	OSMPBF::DenseNodes &dense = *group(Member_Node).mutable_dense();
+
+	lat = scale(lat, granularity);
+	lon = scale(lon, granularity);
+	dense.add_id(id - lastId);
+	dense.add_lat(lat - lastLat);
+	dense.add_lon(lon - lastLon);
+	lastId = id;
+	lastLat = lat;
+	lastLon = lon;
+
+	// DenseInfo columns have to line up with the ids, so nodes added before
+	// the first one with metadata are given empty entries
+	if (meta.version != -1 && !denseMeta){
+		OSMPBF::DenseInfo &info = *dense.mutable_denseinfo();
+		for (int n = 0; n < dense.id_size()-1; n++){
+			info.add_version(-1);
+			info.add_timestamp(0);
+			info.add_changeset(0);
+			info.add_uid(0);
+			info.add_user_sid(0);
+		}
+		denseMeta = true;
+	}
+
+	if (denseMeta){
+		OSMPBF::DenseInfo &info = *dense.mutable_denseinfo();
+		info.add_version(meta.version);
+		info.add_timestamp(meta.timestamp - lastTimestamp);
+		info.add_changeset(meta.changeset - lastChangeset);
+		info.add_uid(meta.uid - lastUid);
+		info.add_user_sid((int32_t)meta.userSid - lastUserSid);
+		lastTimestamp = meta.timestamp;
+		lastChangeset = meta.changeset;
+		lastUid = meta.uid;
+		lastUserSid = meta.userSid;
+	}
+
+	for (size_t n = 0; n < keysVals.size(); n++)
+		dense.add_keys_vals(keysVals[n]);
+	dense.add_keys_vals(0);
+
+	count++;
+}
+
+OSMPBF::Way &BlockBuilder::addWay(){
+	count++;
+	return *group(Member_Way).add_ways();
+}
+
+OSMPBF::Relation &BlockBuilder::addRelation(){
+	count++;
+	return *group(Member_Relation).add_relations();
+}
+
+void BlockBuilder::add(const Node &node){
+	std::vector<uint32_t> keysVals;
+	for (std::map<std::string, std::string>::const_iterator t = node.tags.begin(); t != node.tags.end(); t++){
+		keysVals.push_back(string(t->first));
+		keysVals.push_back(string(t->second));
+	}
+
+	addNode(node.id, llround(node.coords.lat*1000000000.0), llround(node.coords.lon*1000000000.0), keysVals, meta(node.info));
+}
+
+void BlockBuilder::add(const Way &way){
+	Meta m = meta(way.info);
+	OSMPBF::Way &w = addWay();
+	w.set_id(way.id);
+
+	for (std::map<std::string, std::string>::const_iterator t = way.tags.begin(); t != way.tags.end(); t++){
+		w.add_keys(string(t->first));
+		w.add_vals(string(t->second));
+	}
+
+	if (m.version != -1)
+		setInfo(*w.mutable_info(), m);
+
+	int64_t last = 0;
+	for (std::list<uint64_t>::const_iterator ref = way.nodeIds.begin(); ref != way.nodeIds.end(); ref++){
+		w.add_refs((int64_t)*ref - last);
+		last = *ref;
+	}
+}
+
+void BlockBuilder::add(const Relation &relation){
+	Meta m = meta(relation.info);
+	OSMPBF::Relation &r = addRelation();
+	r.set_id(relation.id);
+
+	for (std::map<std::string, std::string>::const_iterator t = relation.tags.begin(); t != relation.tags.end(); t++){
+		r.add_keys(string(t->first));
+		r.add_vals(string(t->second));
+	}
+
+	if (m.version != -1)
+		setInfo(*r.mutable_info(), m);
+
+	int64_t last = 0;
+	for (Relation::MemberList::const_iterator member = relation.members.begin(); member != relation.members.end(); member++){
+		r.add_memids((int64_t)member->id - last);
+		last = member->id;
+		r.add_roles_sid(string(member->role));
+
+		if (member->type == Member_Way)
+			r.add_types(OSMPBF::Relation_MemberType_WAY);
+		else if (member->type == Member_Relation)
+			r.add_types(OSMPBF::Relation_MemberType_RELATION);
+		else
+			r.add_types(OSMPBF::Relation_MemberType_NODE);
+	}
+}
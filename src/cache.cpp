@@ -0,0 +1,107 @@
+#include "protobuf/osm.pb.h"
+#include "libosmpbf.h"
+using namespace libosmpbf;
+
+bool BlockCache::Key::operator < (const Key &k) const {
+	for (int n = 0; n < 5; n++){
+		if (file[n] != k.file[n])
+			return file[n] < k.file[n];
+	}
+	return offset < k.offset;
+}
+
+BlockCache::BlockCache(size_t maxBytes){
+	this->max = maxBytes;
+	this->used = 0;
+	this->hitCount = this->missCount = this->evictCount = 0;
+}
+
+BlockCache::~BlockCache(){
+
+}
+
+uint64_t BlockCache::hits() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	return hitCount;
+}
+
+uint64_t BlockCache::misses() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	return missCount;
+}
+
+uint64_t BlockCache::evictions() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	return evictCount;
+}
+
+size_t BlockCache::bytes() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	return used;
+}
+
+size_t BlockCache::blocks() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	return lru.size();
+}
+
+size_t BlockCache::maxBytes() const {
+	return max;
+}
+
+void BlockCache::clear(){
+	std::lock_guard<std::mutex> lock(mutex);
+	entries.clear();
+	lru.clear();
+	used = 0;
+}
+
+BlockCache::BlockPtr BlockCache::get(const Key &key){
+	std::lock_guard<std::mutex> lock(mutex);
+
+	std::map<Key, EntryList::iterator>::iterator e = entries.find(key);
+	if (e == entries.end()){
+		missCount++;
+		return BlockPtr();
+	}
+
+	hitCount++;
+	lru.splice(lru.begin(), lru, e->second);
+	return e->second->block;
+}
+
+void BlockCache::put(const Key &key, const BlockPtr &block){
+
+	// measured before taking the lock, since it walks the whole block
+	size_t bytes = block->SpaceUsedLong();
+	if (bytes > max)
+		return;
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	// another stream may have decoded the same block in the meantime
+	if (entries.find(key) != entries.end())
+		return;
+
+	evict(bytes);
+
+	Entry entry;
+	entry.key = key;
+	entry.block = block;
+	entry.bytes = bytes;
+	lru.push_front(entry);
+	entries[key] = lru.begin();
+	used += bytes;
+}
+
+// drops least recently used blocks until there is room for the given number
+// of bytes. Blocks still held by a PbfBlock stay valid for as long as it
+// holds them. Must be called with the mutex held.
+void BlockCache::evict(size_t bytes){
+	while (!lru.empty() && used + bytes > max){
+		used -= lru.back().bytes;
+		entries.erase(lru.back().key);
+		lru.pop_back();
+		evictCount++;
+	}
+}
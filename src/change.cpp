@@ -0,0 +1,496 @@
+#include <expat.h>
+#include <zlib.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <iostream>
+
+#include "protobuf/osm.pb.h"
+#include "libosmpbf.h"
+using namespace libosmpbf;
+
+// state of an OsmChange file being read by expat
+struct OscParser {
+	OscParser(OsmChange &c) : changes(c){
+		action = OsmChange::Modify;
+		object = None;
+		ok = true;
+	}
+
+	enum Object {None, NodeObject, WayObject, RelationObject};
+
+	OsmChange &changes;
+	OsmChange::Action action;
+	Object object;
+	Node node;
+	Way way;
+	Relation relation;
+	bool ok;
+};
+
+static const char *attribute(const char **atts, const char *name){
+	for (int n = 0; atts[n]; n += 2){
+		if (strcmp(atts[n], name) == 0)
+			return atts[n+1];
+	}
+	return NULL;
+}
+
+// parses timestamps of the form 2016-01-31T12:00:00Z
+static int64_t timestamp(const char *s){
+	struct tm t;
+	memset(&t, 0, sizeof(t));
+	if (sscanf(s, "%d-%d-%dT%d:%d:%d", &t.tm_year, &t.tm_mon, &t.tm_mday, &t.tm_hour, &t.tm_min, &t.tm_sec) != 6)
+		return 0;
+	t.tm_year -= 1900;
+	t.tm_mon -= 1;
+	return timegm(&t);
+}
+
+static void readInfo(const char **atts, Info &info){
+	const char *v;
+	info = Info();
+	if ((v = attribute(atts, "version")))
+		info.version = atoi(v);
+	if ((v = attribute(atts, "timestamp")))
+		info.timestamp = timestamp(v);
+	if ((v = attribute(atts, "changeset")))
+		info.changeset = strtoll(v, NULL, 10);
+	if ((v = attribute(atts, "uid")))
+		info.uid = atoi(v);
+	if ((v = attribute(atts, "user")))
+		info.user = v;
+}
+
+static uint64_t readId(const char **atts, const char *name){
+	const char *v = attribute(atts, name);
+	return v ? strtoll(v, NULL, 10) : 0;
+}
+
+static void XMLCALL startElement(void *data, const char *name, const char **atts){
+	OscParser &p = *(OscParser*)data;
+
+	if (strcmp(name, "create") == 0){
+		p.action = OsmChange::Create;
+	} else if (strcmp(name, "modify") == 0){
+		p.action = OsmChange::Modify;
+	} else if (strcmp(name, "delete") == 0){
+		p.action = OsmChange::Delete;
+	} else if (strcmp(name, "node") == 0){
+		p.object = OscParser::NodeObject;
+		p.node = Node();
+		p.node.id = readId(atts, "id");
+		const char *lat = attribute(atts, "lat");
+		const char *lon = attribute(atts, "lon");
+		if (lat && lon){
+			p.node.coords.lat = atof(lat);
+			p.node.coords.lon = atof(lon);
+		}
+		readInfo(atts, p.node.info);
+	} else if (strcmp(name, "way") == 0){
+		p.object = OscParser::WayObject;
+		p.way = Way();
+		p.way.id = readId(atts, "id");
+		readInfo(atts, p.way.info);
+	} else if (strcmp(name, "relation") == 0){
+		p.object = OscParser::RelationObject;
+		p.relation = Relation();
+		p.relation.id = readId(atts, "id");
+		readInfo(atts, p.relation.info);
+	} else if (strcmp(name, "tag") == 0){
+		const char *k = attribute(atts, "k");
+		const char *v = attribute(atts, "v");
+		if (!k || !v)
+			return;
+		if (p.object == OscParser::NodeObject)
+			p.node.tags[k] = v;
+		else if (p.object == OscParser::WayObject)
+			p.way.tags[k] = v;
+		else if (p.object == OscParser::RelationObject)
+			p.relation.tags[k] = v;
+	} else if (strcmp(name, "nd") == 0){
+		if (p.object == OscParser::WayObject)
+			p.way.nodeIds.push_back(readId(atts, "ref"));
+	} else if (strcmp(name, "member") == 0){
+		if (p.object != OscParser::RelationObject)
+			return;
+		const char *type = attribute(atts, "type");
+		const char *role = attribute(atts, "role");
+		MemberType t = Member_Node;
+		if (type && strcmp(type, "way") == 0)
+			t = Member_Way;
+		else if (type && strcmp(type, "relation") == 0)
+			t = Member_Relation;
+		p.relation.members.push_back(Relation::Member(readId(atts, "ref"), t, role ? role : ""));
+	}
+}
+
+static void XMLCALL endElement(void *data, const char *name){
+	OscParser &p = *(OscParser*)data;
+
+	if (strcmp(name, "node") == 0 && p.object == OscParser::NodeObject){
+		p.changes.add(p.action, p.node);
+		p.object = OscParser::None;
+	} else if (strcmp(name, "way") == 0 && p.object == OscParser::WayObject){
+		p.changes.add(p.action, p.way);
+		p.object = OscParser::None;
+	} else if (strcmp(name, "relation") == 0 && p.object == OscParser::RelationObject){
+		p.changes.add(p.action, p.relation);
+		p.object = OscParser::None;
+	}
+}
+
+OsmChange::OsmChange(){
+
+}
+
+bool OsmChange::load(const char *file){
+
+	// gzread passes uncompressed files through as they are
+	gzFile in = gzopen(file, "rb");
+	if (!in){
+		std::cerr << "Unable to open " << file << "\n";
+		return false;
+	}
+
+	OscParser p(*this);
+	XML_Parser parser = XML_ParserCreate(NULL);
+	XML_SetUserData(parser, &p);
+	XML_SetElementHandler(parser, startElement, endElement);
+
+	char buf[65536];
+	int len;
+	do {
+		len = gzread(in, buf, sizeof(buf));
+		if (len < 0 || XML_Parse(parser, buf, len, len == 0) == XML_STATUS_ERROR){
+			std::cerr << "Unable to parse " << file << ": "
+				<< XML_ErrorString(XML_GetErrorCode(parser))
+				<< " at line " << XML_GetCurrentLineNumber(parser) << "\n";
+			p.ok = false;
+			break;
+		}
+	} while (len > 0);
+
+	XML_ParserFree(parser);
+	gzclose(in);
+	return p.ok;
+}
+
+void OsmChange::add(Action action, const Node &node){
+	Change<Node> &c = nodeChanges[node.id];
+	c.action = action;
+	c.object = node;
+}
+
+void OsmChange::add(Action action, const Way &way){
+	Change<Way> &c = wayChanges[way.id];
+	c.action = action;
+	c.object = way;
+}
+
+void OsmChange::add(Action action, const Relation &relation){
+	Change<Relation> &c = relationChanges[relation.id];
+	c.action = action;
+	c.object = relation;
+}
+
+const OsmChange::NodeChanges &OsmChange::nodes() const {return nodeChanges;}
+const OsmChange::WayChanges &OsmChange::ways() const {return wayChanges;}
+const OsmChange::RelationChanges &OsmChange::relations() const {return relationChanges;}
+
+size_t OsmChange::size() const {
+	return nodeChanges.size() + wayChanges.size() + relationChanges.size();
+}
+
+void OsmChange::clear(){
+	nodeChanges.clear();
+	wayChanges.clear();
+	relationChanges.clear();
+}
+
+ChangeStream::ChangeStream(PbfStream &i, const OsmChange &c) : in(i), changes(c){
+	ok = true;
+	finished = false;
+	current = Member_Node;
+	nextNode = changes.nodes().begin();
+	nextWay = changes.ways().begin();
+	nextRelation = changes.relations().begin();
+}
+
+ChangeStream::~ChangeStream(){
+
+}
+
+ChangeStream::operator bool () const {
+	return ok;
+}
+
+bool ChangeStream::operator ! () const {
+	return !ok;
+}
+
+ChangeStream &ChangeStream::operator >> (PbfBlock &block){
+
+	while (ready.empty() && !finished){
+
+		PbfBlock source;
+		if (!(in >> source)){
+			finished = true;
+			if (in.bad())
+				break;
+
+			// whatever is left sorts after the end of the file
+			startType(Member_Relation);
+			flush(Member_Relation);
+			emit(true);
+			break;
+		}
+
+		const OSMPBF::PrimitiveBlock &b = *source.block;
+		BlockIndexEntry range;
+		range.add(b);
+
+		// changes to earlier types go before this block
+		for (int t = Member_Node; t <= Member_Relation; t++){
+			if (range.has((MemberType)t)){
+				startType((MemberType)t);
+				break;
+			}
+		}
+
+		if (affects(range)){
+			merge(b);
+		} else {
+			emit(true);
+			ready.push_back(source);
+		}
+	}
+
+	if (ready.empty()){
+		ok = false;
+	} else {
+		block = ready.front();
+		ready.pop_front();
+	}
+
+	return *this;
+}
+
+bool ChangeStream::pending(MemberType type, uint64_t &id) const {
+	if (type == Member_Node && nextNode != changes.nodes().end())
+		id = nextNode->first;
+	else if (type == Member_Way && nextWay != changes.ways().end())
+		id = nextWay->first;
+	else if (type == Member_Relation && nextRelation != changes.relations().end())
+		id = nextRelation->first;
+	else
+		return false;
+	return true;
+}
+
+// a block has to be rebuilt when a change falls within the ids it holds
+// for some type, or when changes to one of its types have to be written
+// before the objects of a later type it also holds
+bool ChangeStream::affects(const BlockIndexEntry &range) const {
+	bool later = false;
+	for (int t = Member_Relation; t >= Member_Node; t--){
+		MemberType type = (MemberType)t;
+		if (!range.has(type))
+			continue;
+
+		uint64_t id;
+		if (pending(type, id) && (id <= range.maxId[type] || later))
+			return true;
+		later = true;
+	}
+	return false;
+}
+
+void ChangeStream::merge(const OSMPBF::PrimitiveBlock &b){
+
+	strings.assign(b.stringtable().s_size(), 0);
+
+	for (int t = Member_Node; t <= Member_Relation; t++){
+		MemberType type = (MemberType)t;
+		bool started = false;
+
+		for (int g = 0; g < b.primitivegroup_size(); g++){
+			const OSMPBF::PrimitiveGroup &group = b.primitivegroup(g);
+
+			if (type == Member_Node && (group.dense().id_size() > 0 || group.nodes_size() > 0)){
+				if (!started)
+					startType(type);
+				started = true;
+				copyNodes(b, group);
+			} else if (type == Member_Way && group.ways_size() > 0){
+				if (!started)
+					startType(type);
+				started = true;
+				for (int i = 0; i < group.ways_size(); i++){
+					if (advance(nextWay, changes.ways(), group.ways(i).id()))
+						copyWay(b, group.ways(i));
+				}
+			} else if (type == Member_Relation && group.relations_size() > 0){
+				if (!started)
+					startType(type);
+				started = true;
+				for (int i = 0; i < group.relations_size(); i++){
+					if (advance(nextRelation, changes.relations(), group.relations(i).id()))
+						copyRelation(b, group.relations(i));
+				}
+			}
+		}
+	}
+
+	emit(true);
+}
+
+// writes every remaining change of the given type
+void ChangeStream::flush(MemberType type){
+	if (type == Member_Node){
+		for (; nextNode != changes.nodes().end(); nextNode++)
+			write(nextNode->second);
+	} else if (type == Member_Way){
+		for (; nextWay != changes.ways().end(); nextWay++)
+			write(nextWay->second);
+	} else {
+		for (; nextRelation != changes.relations().end(); nextRelation++)
+			write(nextRelation->second);
+	}
+}
+
+void ChangeStream::startType(MemberType type){
+	for (; current < type; current = (MemberType)(current+1))
+		flush(current);
+}
+
+// moves the block being built to the output once it is full, or whenever
+// it has anything in it if force is set
+void ChangeStream::emit(bool force){
+	if (builder.objects() == 0 || (!force && !builder.full()))
+		return;
+
+	PbfBlock block;
+	builder.build(block);
+	ready.push_back(block);
+
+	// string ids of the new block start over
+	std::fill(strings.begin(), strings.end(), 0);
+}
+
+template <typename Changes>
+bool ChangeStream::advance(typename Changes::const_iterator &next, const Changes &all, uint64_t id){
+	for (; next != all.end() && next->first < id; next++)
+		write(next->second);
+
+	if (next != all.end() && next->first == id){
+		write(next->second);
+		next++;
+		return false;
+	}
+
+	return true;
+}
+
+template <typename T>
+void ChangeStream::write(const OsmChange::Change<T> &change){
+	if (change.action == OsmChange::Delete)
+		return;
+	builder.add(change.object);
+	emit(false);
+}
+
+uint32_t ChangeStream::remap(const OSMPBF::PrimitiveBlock &b, uint32_t sid){
+	if (sid == 0 || sid >= strings.size())
+		return 0;
+	if (strings[sid] == 0)
+		strings[sid] = builder.string(b.stringtable().s(sid));
+	return strings[sid];
+}
+
+BlockBuilder::Meta ChangeStream::meta(const OSMPBF::PrimitiveBlock &b, const OSMPBF::Info &info){
+	BlockBuilder::Meta m;
+	m.version = info.version();
+	m.timestamp = info.timestamp() * b.date_granularity() / 1000;
+	m.changeset = info.changeset();
+	m.uid = info.uid();
+	m.userSid = remap(b, info.user_sid());
+	return m;
+}
+
+void ChangeStream::copyNodes(const OSMPBF::PrimitiveBlock &b, const OSMPBF::PrimitiveGroup &group){
+
+	std::vector<uint32_t> keysVals;
+
+	DenseCursor c(group.dense());
+	while (c.next()){
+		if (!advance(nextNode, changes.nodes(), c.id))
+			continue;
+
+		// tags are only remapped once the node is known to be copied, as
+		// advance() may emit the block they would map into
+		keysVals.clear();
+		for (int t = 0, tags = c.tags(); t < tags; t++){
+			keysVals.push_back(remap(b, c.columns.keysVals[c.kv + 2*t]));
+			keysVals.push_back(remap(b, c.columns.keysVals[c.kv + 2*t + 1]));
+		}
+
+		BlockBuilder::Meta m;
+		if (c.hasInfo){
+			m.version = c.columns.version[c.node];
+			m.timestamp = c.timestamp * b.date_granularity() / 1000;
+			m.changeset = c.changeset;
+			m.uid = c.uid;
+			m.userSid = remap(b, c.userSid);
+		}
+
+		builder.addNode(c.id, b.lat_offset() + c.lat*b.granularity(), b.lon_offset() + c.lon*b.granularity(), keysVals, m);
+		emit(false);
+	}
+
+	for (int i = 0; i < group.nodes_size(); i++){
+		const OSMPBF::Node &node = group.nodes(i);
+		if (!advance(nextNode, changes.nodes(), node.id()))
+			continue;
+
+		keysVals.clear();
+		for (int t = 0; t < node.keys_size() && t < node.vals_size(); t++){
+			keysVals.push_back(remap(b, node.keys(t)));
+			keysVals.push_back(remap(b, node.vals(t)));
+		}
+
+		BlockBuilder::Meta m;
+		if (node.has_info())
+			m = meta(b, node.info());
+
+		builder.addNode(node.id(), b.lat_offset() + node.lat()*b.granularity(), b.lon_offset() + node.lon()*b.granularity(), keysVals, m);
+		emit(false);
+	}
+}
+
+// ways and relations are copied as they are, apart from their string ids
+void ChangeStream::copyWay(const OSMPBF::PrimitiveBlock &b, const OSMPBF::Way &way){
+	OSMPBF::Way &w = builder.addWay();
+	w = way;
+	for (int t = 0; t < w.keys_size(); t++)
+		w.set_keys(t, remap(b, w.keys(t)));
+	for (int t = 0; t < w.vals_size(); t++)
+		w.set_vals(t, remap(b, w.vals(t)));
+	if (w.has_info())
+		BlockBuilder::setInfo(*w.mutable_info(), meta(b, way.info()));
+	emit(false);
+}
+
+void ChangeStream::copyRelation(const OSMPBF::PrimitiveBlock &b, const OSMPBF::Relation &relation){
+	OSMPBF::Relation &r = builder.addRelation();
+	r = relation;
+	for (int t = 0; t < r.keys_size(); t++)
+		r.set_keys(t, remap(b, r.keys(t)));
+	for (int t = 0; t < r.vals_size(); t++)
+		r.set_vals(t, remap(b, r.vals(t)));
+	for (int m = 0; m < r.roles_sid_size(); m++)
+		r.set_roles_sid(m, remap(b, r.roles_sid(m)));
+	if (r.has_info())
+		BlockBuilder::setInfo(*r.mutable_info(), meta(b, relation.info()));
+	emit(false);
+}
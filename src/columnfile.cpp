@@ -0,0 +1,345 @@
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <string.h>
+
+#include "protobuf/osm.pb.h"
+#include "libosmpbf.h"
+#include "identity.h"
+using namespace libosmpbf;
+
+// A sidecar is a run of blocks, each its array sizes followed by the arrays
+// themselves padded to 8 bytes, then a directory of where each block starts
+// and this trailer. Everything is in host byte order. The last byte of the
+// magic is the format version; version 1 kept a shorter source identity.
+static const char columnMagic[8] = {'O','S','M','P','B','F','C','2'};
+
+struct ColumnTrailer {
+	uint64_t source[5];
+	uint64_t blocks;
+	uint64_t directory;
+	char magic[8];
+};
+
+// bytes per element of each ColumnBlock::Array
+static const size_t elementSize[ColumnBlock::Arrays] = {
+	4, 1,
+	8, 8, 8, 4, 4, 4,
+	8, 4, 8, 4, 4, 4,
+	8, 4, 8, 1, 4,
+	4, 4, 4
+};
+
+static size_t padded(size_t bytes){
+	return (bytes + 7) & ~(size_t)7;
+}
+
+ColumnWriter::ColumnWriter(const char *file, const char *source) : std::ofstream(file, std::ios_base::binary | std::ios_base::trunc){
+
+	// a source that is not a regular file is recorded as all zeros, which
+	// no source a ColumnFile checks against can match
+	memset(this->sourceId, 0, sizeof(this->sourceId));
+	fileIdentity(source, this->sourceId);
+	this->finished = false;
+}
+
+ColumnWriter::~ColumnWriter(){
+	if (!this->finished)
+		finish();
+}
+
+std::ostream &ColumnWriter::operator << (const PbfBlock &block){
+	block.columns(this->columns);
+	return *this << this->columns;
+}
+
+void ColumnWriter::writeArray(const void *data, size_t size){
+	static const char zeros[8] = {0};
+	if (size > 0)
+		this->write((const char*)data, size);
+	this->write(zeros, padded(size) - size);
+}
+
+std::ostream &ColumnWriter::operator << (const BlockColumns &c){
+	if (this->finished){
+		this->setstate(std::ios_base::failbit);
+		return *this;
+	}
+
+	this->offsets.push_back(this->tellp());
+
+	uint64_t sizes[ColumnBlock::Arrays] = {
+		c.stringOffsets.size(), c.strings.size(),
+		c.nodes.id.size(), c.nodes.lat.size(), c.nodes.lon.size(),
+		c.nodes.tags.offsets.size(), c.nodes.tags.keys.size(), c.nodes.tags.values.size(),
+		c.ways.id.size(), c.ways.refOffsets.size(), c.ways.refs.size(),
+		c.ways.tags.offsets.size(), c.ways.tags.keys.size(), c.ways.tags.values.size(),
+		c.relations.id.size(), c.relations.memberOffsets.size(), c.relations.memberIds.size(),
+		c.relations.memberTypes.size(), c.relations.memberRoles.size(),
+		c.relations.tags.offsets.size(), c.relations.tags.keys.size(), c.relations.tags.values.size()
+	};
+	this->write((const char*)sizes, sizeof(sizes));
+
+	const void *arrays[ColumnBlock::Arrays] = {
+		c.stringOffsets.data(), c.strings.data(),
+		c.nodes.id.data(), c.nodes.lat.data(), c.nodes.lon.data(),
+		c.nodes.tags.offsets.data(), c.nodes.tags.keys.data(), c.nodes.tags.values.data(),
+		c.ways.id.data(), c.ways.refOffsets.data(), c.ways.refs.data(),
+		c.ways.tags.offsets.data(), c.ways.tags.keys.data(), c.ways.tags.values.data(),
+		c.relations.id.data(), c.relations.memberOffsets.data(), c.relations.memberIds.data(),
+		c.relations.memberTypes.data(), c.relations.memberRoles.data(),
+		c.relations.tags.offsets.data(), c.relations.tags.keys.data(), c.relations.tags.values.data()
+	};
+	for (int a = 0; a < ColumnBlock::Arrays; a++)
+		writeArray(arrays[a], sizes[a]*elementSize[a]);
+
+	return *this;
+}
+
+bool ColumnWriter::finish(){
+	if (this->finished)
+		return !this->fail();
+	this->finished = true;
+
+	ColumnTrailer trailer;
+	memcpy(trailer.source, this->sourceId, sizeof(trailer.source));
+	trailer.blocks = this->offsets.size();
+	trailer.directory = this->tellp();
+	memcpy(trailer.magic, columnMagic, sizeof(trailer.magic));
+
+	if (!this->offsets.empty())
+		this->write((const char*)&this->offsets[0], this->offsets.size()*sizeof(uint64_t));
+	this->write((const char*)&trailer, sizeof(trailer));
+	this->flush();
+
+	return !this->fail();
+}
+
+ColumnFile::ColumnFile(const char *file, const char *source){
+	this->data = NULL;
+	this->length = 0;
+	this->offsets = NULL;
+	this->count = 0;
+
+	int fd = open(file, O_RDONLY);
+	if (fd < 0)
+		return;
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(ColumnTrailer)){
+		close(fd);
+		return;
+	}
+
+	void *map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return;
+
+	this->data = (const char*)map;
+	this->length = st.st_size;
+	madvise(map, this->length, MADV_SEQUENTIAL);
+
+	// a sidecar that was never finished, is of another format version, or
+	// belongs to some other file or one that cannot be told apart, is
+	// treated as if there were none
+	ColumnTrailer trailer;
+	memcpy(&trailer, this->data + this->length - sizeof(trailer), sizeof(trailer));
+	uint64_t id[5];
+	if (memcmp(trailer.magic, columnMagic, sizeof(columnMagic)) != 0
+			|| trailer.directory % 8 != 0
+			|| trailer.directory + trailer.blocks*sizeof(uint64_t) + sizeof(trailer) != this->length
+			|| (source && (!fileIdentity(source, id) || memcmp(trailer.source, id, sizeof(id)) != 0))){
+		munmap(map, this->length);
+		this->data = NULL;
+		this->length = 0;
+		return;
+	}
+
+	this->offsets = (const uint64_t*)(this->data + trailer.directory);
+	this->count = trailer.blocks;
+}
+
+ColumnFile::~ColumnFile(){
+	if (this->data)
+		munmap((void*)this->data, this->length);
+}
+
+ColumnFile::operator bool () const {
+	return this->data != NULL;
+}
+
+size_t ColumnFile::blocks() const {
+	return this->count;
+}
+
+ColumnBlock ColumnFile::block(size_t i) const {
+	ColumnBlock block;
+	if (i >= this->count)
+		return block;
+
+	const char *end = (const char*)this->offsets;
+	const char *p = this->data + this->offsets[i];
+	if (p + ColumnBlock::Arrays*sizeof(uint64_t) > end)
+		return block;
+
+	const uint64_t *sizes = (const uint64_t*)p;
+	p += ColumnBlock::Arrays*sizeof(uint64_t);
+
+	const char *arrays[ColumnBlock::Arrays];
+	for (int a = 0; a < ColumnBlock::Arrays; a++){
+		arrays[a] = p;
+		p += padded(sizes[a]*elementSize[a]);
+	}
+	if (p > end)
+		return block;
+
+	block.sizes = sizes;
+	memcpy(block.arrays, arrays, sizeof(arrays));
+
+	const int32_t *stringOffsets = block.array<int32_t>(ColumnBlock::StringOffsets);
+	const char *strings = block.array<char>(ColumnBlock::Strings);
+	size_t n = sizes[ColumnBlock::StringOffsets];
+	block.strings->resize(n > 0 ? n - 1 : 0);
+	for (size_t s = 0; s + 1 < n; s++)
+		(*block.strings)[s].assign(strings + stringOffsets[s], stringOffsets[s + 1] - stringOffsets[s]);
+
+	return block;
+}
+
+static const uint64_t noSizes[ColumnBlock::Arrays] = {0};
+
+ColumnBlock::ColumnBlock() : strings(new std::vector<std::string>){
+	this->sizes = noSizes;
+	for (int a = 0; a < Arrays; a++)
+		this->arrays[a] = NULL;
+}
+
+const std::string &ColumnBlock::string(uint32_t sid) const {
+	return (*this->strings)[sid];
+}
+
+size_t ColumnBlock::size(Array a) const {
+	return this->sizes[a];
+}
+
+BlockTag ColumnBlock::tag(Array offsets, Array keys, Array values, size_t i, int t) const {
+	size_t j = array<int32_t>(offsets)[i] + t;
+	return BlockTag(string(array<int32_t>(keys)[j]), string(array<int32_t>(values)[j]));
+}
+
+size_t ColumnBlock::Nodes() const {
+	return this->sizes[NodeIds];
+}
+
+ColumnBlock::NodeIterator ColumnBlock::nodesBegin() const {
+	return NodeIterator(*this, 0);
+}
+
+ColumnBlock::NodeIterator ColumnBlock::nodesEnd() const {
+	return NodeIterator(*this, Nodes());
+}
+
+size_t ColumnBlock::Ways() const {
+	return this->sizes[WayIds];
+}
+
+ColumnBlock::WayIterator ColumnBlock::waysBegin() const {
+	return WayIterator(*this, 0);
+}
+
+ColumnBlock::WayIterator ColumnBlock::waysEnd() const {
+	return WayIterator(*this, Ways());
+}
+
+size_t ColumnBlock::Relations() const {
+	return this->sizes[RelationIds];
+}
+
+ColumnBlock::RelationIterator ColumnBlock::relationsBegin() const {
+	return RelationIterator(*this, 0);
+}
+
+ColumnBlock::RelationIterator ColumnBlock::relationsEnd() const {
+	return RelationIterator(*this, Relations());
+}
+
+ColumnBlock::Node::Node(const ColumnBlock &b, size_t i) : block(b), i(i){
+
+}
+
+uint64_t ColumnBlock::Node::id() const {
+	return block.array<uint64_t>(NodeIds)[i];
+}
+
+Coords ColumnBlock::Node::coords() const {
+	Coords coords;
+	coords.lat = block.array<double>(NodeLats)[i];
+	coords.lon = block.array<double>(NodeLons)[i];
+	return coords;
+}
+
+int ColumnBlock::Node::tags() const {
+	const int32_t *offsets = block.array<int32_t>(NodeTagOffsets);
+	return offsets[i + 1] - offsets[i];
+}
+
+BlockTag ColumnBlock::Node::tags(int t) const {
+	return block.tag(NodeTagOffsets, NodeTagKeys, NodeTagValues, i, t);
+}
+
+ColumnBlock::Way::Way(const ColumnBlock &b, size_t i) : block(b), i(i){
+
+}
+
+uint64_t ColumnBlock::Way::id() const {
+	return block.array<uint64_t>(WayIds)[i];
+}
+
+int ColumnBlock::Way::tags() const {
+	const int32_t *offsets = block.array<int32_t>(WayTagOffsets);
+	return offsets[i + 1] - offsets[i];
+}
+
+BlockTag ColumnBlock::Way::tags(int t) const {
+	return block.tag(WayTagOffsets, WayTagKeys, WayTagValues, i, t);
+}
+
+int ColumnBlock::Way::nodes() const {
+	const int32_t *offsets = block.array<int32_t>(WayRefOffsets);
+	return offsets[i + 1] - offsets[i];
+}
+
+uint64_t ColumnBlock::Way::nodes(int n) const {
+	return block.array<uint64_t>(WayRefs)[block.array<int32_t>(WayRefOffsets)[i] + n];
+}
+
+ColumnBlock::Relation::Relation(const ColumnBlock &b, size_t i) : block(b), i(i){
+
+}
+
+uint64_t ColumnBlock::Relation::id() const {
+	return block.array<uint64_t>(RelationIds)[i];
+}
+
+int ColumnBlock::Relation::tags() const {
+	const int32_t *offsets = block.array<int32_t>(RelationTagOffsets);
+	return offsets[i + 1] - offsets[i];
+}
+
+BlockTag ColumnBlock::Relation::tags(int t) const {
+	return block.tag(RelationTagOffsets, RelationTagKeys, RelationTagValues, i, t);
+}
+
+int ColumnBlock::Relation::members() const {
+	const int32_t *offsets = block.array<int32_t>(RelationMemberOffsets);
+	return offsets[i + 1] - offsets[i];
+}
+
+BlockRelation::Member ColumnBlock::Relation::members(int m) const {
+	size_t j = block.array<int32_t>(RelationMemberOffsets)[i] + m;
+	return BlockRelation::Member(block.array<uint64_t>(RelationMemberIds)[j],
+		(MemberType)block.array<int8_t>(RelationMemberTypes)[j],
+		block.string(block.array<int32_t>(RelationMemberRoles)[j]));
+}
@@ -0,0 +1,151 @@
+#include "protobuf/osm.pb.h"
+#include "libosmpbf.h"
+#include "workers.h"
+using namespace libosmpbf;
+
+void TagColumns::clear(){
+	offsets.clear();
+	keys.clear();
+	values.clear();
+}
+
+void BlockColumns::clear(){
+	stringOffsets.clear();
+	strings.clear();
+
+	nodes.id.clear();
+	nodes.lat.clear();
+	nodes.lon.clear();
+	nodes.tags.clear();
+
+	ways.id.clear();
+	ways.refOffsets.clear();
+	ways.refs.clear();
+	ways.tags.clear();
+
+	relations.id.clear();
+	relations.memberOffsets.clear();
+	relations.memberIds.clear();
+	relations.memberTypes.clear();
+	relations.memberRoles.clear();
+	relations.tags.clear();
+}
+
+// tags stored as parallel key and value string ids, as ways, relations
+// and plain nodes have them
+template <typename T>
+static void addTags(TagColumns &tags, const T &object){
+	for (int k = 0; k < object.keys_size() && k < object.vals_size(); k++){
+		tags.keys.push_back(object.keys(k));
+		tags.values.push_back(object.vals(k));
+	}
+	tags.offsets.push_back(tags.keys.size());
+}
+
+static void addDenseNodes(BlockColumns::Nodes &nodes, const OSMPBF::PrimitiveBlock &block, const OSMPBF::DenseNodes &dense){
+	int n = dense.id_size();
+	int64_t granularity = block.granularity();
+	int64_t latOffset = block.lat_offset(), lonOffset = block.lon_offset();
+
+	// the DenseNodes columns can be sized for up front; tags cannot
+	nodes.id.reserve(nodes.id.size() + n);
+	nodes.lat.reserve(nodes.lat.size() + n);
+	nodes.lon.reserve(nodes.lon.size() + n);
+	nodes.tags.offsets.reserve(nodes.tags.offsets.size() + n);
+
+	DenseCursor c(dense, DenseCursor::Coords | DenseCursor::Tags);
+	while (c.next()){
+		nodes.id.push_back(c.id);
+		nodes.lat.push_back((latOffset + c.lat*granularity)/1000000000.0);
+		nodes.lon.push_back((lonOffset + c.lon*granularity)/1000000000.0);
+
+		for (int t = 0, tags = c.tags(); t < tags; t++){
+			nodes.tags.keys.push_back(dense.keys_vals(c.kv + 2*t));
+			nodes.tags.values.push_back(dense.keys_vals(c.kv + 2*t + 1));
+		}
+		nodes.tags.offsets.push_back(nodes.tags.keys.size());
+	}
+}
+
+size_t PbfBlock::columns(BlockColumns &columns) const {
+
+	columns.clear();
+
+	const OSMPBF::StringTable &table = block->stringtable();
+	columns.stringOffsets.reserve(table.s_size() + 1);
+	columns.stringOffsets.push_back(0);
+	for (int i = 0; i < table.s_size(); i++){
+		columns.strings.insert(columns.strings.end(), table.s(i).begin(), table.s(i).end());
+		columns.stringOffsets.push_back(columns.strings.size());
+	}
+
+	columns.nodes.tags.offsets.push_back(0);
+	columns.ways.refOffsets.push_back(0);
+	columns.ways.tags.offsets.push_back(0);
+	columns.relations.memberOffsets.push_back(0);
+	columns.relations.tags.offsets.push_back(0);
+
+	for (int g = 0; g < block->primitivegroup_size(); g++){
+		const OSMPBF::PrimitiveGroup &group = block->primitivegroup(g);
+
+		if (group.dense().id_size() > 0)
+			addDenseNodes(columns.nodes, *block, group.dense());
+
+		for (int i = 0; i < group.nodes_size(); i++){
+			const OSMPBF::Node &node = group.nodes(i);
+			Coords coords(node.lat(), node.lon(), block->granularity(), block->lat_offset(), block->lon_offset());
+			columns.nodes.id.push_back(node.id());
+			columns.nodes.lat.push_back(coords.lat);
+			columns.nodes.lon.push_back(coords.lon);
+			addTags(columns.nodes.tags, node);
+		}
+
+		for (int i = 0; i < group.ways_size(); i++){
+			const OSMPBF::Way &way = group.ways(i);
+			columns.ways.id.push_back(way.id());
+
+			int64_t ref = 0;
+			for (int r = 0; r < way.refs_size(); r++){
+				ref += way.refs(r);
+				columns.ways.refs.push_back(ref);
+			}
+			columns.ways.refOffsets.push_back(columns.ways.refs.size());
+			addTags(columns.ways.tags, way);
+		}
+
+		for (int i = 0; i < group.relations_size(); i++){
+			const OSMPBF::Relation &relation = group.relations(i);
+			columns.relations.id.push_back(relation.id());
+
+			int64_t member = 0;
+			for (int m = 0; m < relation.memids_size(); m++){
+				member += relation.memids(m);
+				columns.relations.memberIds.push_back(member);
+				columns.relations.memberTypes.push_back(m < relation.types_size() ? (int8_t)relation.types(m) : (int8_t)Member_Node);
+				columns.relations.memberRoles.push_back(m < relation.roles_sid_size() ? relation.roles_sid(m) : 0);
+			}
+			columns.relations.memberOffsets.push_back(columns.relations.memberIds.size());
+			addTags(columns.relations.tags, relation);
+		}
+	}
+
+	return columns.nodes.id.size() + columns.ways.id.size() + columns.relations.id.size();
+}
+
+ColumnConverter::ColumnConverter(unsigned threads) : workers(new WorkerPool(threads)){
+
+}
+
+ColumnConverter::~ColumnConverter(){
+
+}
+
+void ColumnConverter::convert(const std::vector<PbfBlock> &blocks, std::vector<BlockColumns> &tables){
+	tables.resize(blocks.size());
+
+	// blocks differ a lot in how long they take, so each thread takes the
+	// next one left rather than a fixed share
+	workers->run(blocks.size(), [&](size_t b, unsigned){
+		blocks[b].columns(tables[b]);
+	});
+}
@@ -0,0 +1,238 @@
+#include <algorithm>
+#include <cmath>
+
+#include "libosmpbf.h"
+#include "workers.h"
+using namespace libosmpbf;
+
+// mean radius of the earth, in metres
+static const double earthRadius = 6371008.8;
+static const double radians = M_PI/180.0;
+
+LocationLookup::~LocationLookup(){
+
+}
+
+NodeLocations::NodeLocations(){
+	this->sorted = true;
+}
+
+void NodeLocations::add(uint64_t id, const Coords &coords){
+	if (!this->ids.empty() && id < this->ids.back())
+		this->sorted = false;
+	this->ids.push_back(id);
+	this->lats.push_back(coords.lat);
+	this->lons.push_back(coords.lon);
+}
+
+// adds the nodes of a block as apply() walks them
+struct LocationAdder {
+	LocationAdder(NodeLocations &l) : locations(l){}
+	void node(const BlockNode &node){locations.add(node.id(), node.coords());}
+	NodeLocations &locations;
+};
+
+void NodeLocations::add(const PbfBlock &block){
+	LocationAdder adder(*this);
+	apply(block, adder);
+}
+
+size_t NodeLocations::size() const {
+	return this->ids.size();
+}
+
+void NodeLocations::clear(){
+	this->ids.clear();
+	this->lats.clear();
+	this->lons.clear();
+	this->sorted = true;
+}
+
+// orders positions in the columns by the id at that position
+struct IdOrder {
+	IdOrder(const std::vector<uint64_t> &i) : ids(i){}
+	bool operator () (size_t a, size_t b) const {return ids[a] < ids[b];}
+	const std::vector<uint64_t> &ids;
+};
+
+size_t NodeLocations::locations(const uint64_t *ids, size_t n, double *lat, double *lon) const {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!this->sorted){
+			std::vector<size_t> order(this->ids.size());
+			for (size_t i = 0; i < order.size(); i++)
+				order[i] = i;
+			std::stable_sort(order.begin(), order.end(), IdOrder(this->ids));
+
+			std::vector<uint64_t> sortedIds(order.size());
+			std::vector<double> sortedLats(order.size()), sortedLons(order.size());
+			for (size_t i = 0; i < order.size(); i++){
+				sortedIds[i] = this->ids[order[i]];
+				sortedLats[i] = this->lats[order[i]];
+				sortedLons[i] = this->lons[order[i]];
+			}
+			this->ids.swap(sortedIds);
+			this->lats.swap(sortedLats);
+			this->lons.swap(sortedLons);
+			this->sorted = true;
+		}
+	}
+
+	// the nodes of a way are mostly close together in id, so each search
+	// gallops out from where the last one ended before narrowing down
+	const uint64_t *column = this->ids.data();
+	size_t size = this->ids.size(), hint = 0, found = 0;
+	for (size_t i = 0; i < n; i++){
+		uint64_t id = ids[i];
+		size_t low, high;
+		if (hint < size && column[hint] < id){
+			low = hint + 1;
+			size_t step = 1;
+			while (low + step < size && column[low + step] < id)
+				step *= 2;
+			high = std::min(low + step + 1, size);
+		} else {
+			high = hint < size ? hint + 1 : size;
+			size_t step = 1;
+			while (step < high && column[high - step - 1] >= id)
+				step *= 2;
+			low = high > step ? high - step - 1 : 0;
+		}
+
+		size_t p = std::lower_bound(column + low, column + high, id) - column;
+		if (p < size && column[p] == id){
+			lat[i] = this->lats[p];
+			lon[i] = this->lons[p];
+			found++;
+		} else
+			lat[i] = lon[i] = NAN;
+		hint = p;
+	}
+	return found;
+}
+
+WayGeometry::WayGeometry(){
+	minLat = minLon = maxLat = maxLon = NAN;
+	length = area = 0;
+	missing = 0;
+}
+
+void WayGeometry::compute(const double *lat, const double *lon, size_t n, bool closed){
+	this->length = this->area = 0;
+	if (n == 0){
+		this->minLat = this->minLon = this->maxLat = this->maxLon = NAN;
+		return;
+	}
+
+	// each quantity in a loop of its own over whole columns, which keeps
+	// every loop free of branches
+	double minLat = lat[0], maxLat = lat[0];
+	for (size_t i = 1; i < n; i++){
+		minLat = lat[i] < minLat ? lat[i] : minLat;
+		maxLat = lat[i] > maxLat ? lat[i] : maxLat;
+	}
+	double minLon = lon[0], maxLon = lon[0];
+	for (size_t i = 1; i < n; i++){
+		minLon = lon[i] < minLon ? lon[i] : minLon;
+		maxLon = lon[i] > maxLon ? lon[i] : maxLon;
+	}
+	this->minLat = minLat;
+	this->maxLat = maxLat;
+	this->minLon = minLon;
+	this->maxLon = maxLon;
+
+	// haversine distance between consecutive points
+	double length = 0;
+	for (size_t i = 1; i < n; i++){
+		double dLat = (lat[i] - lat[i-1])*radians;
+		double dLon = (lon[i] - lon[i-1])*radians;
+		double a = std::sin(dLat/2)*std::sin(dLat/2)
+			+ std::cos(lat[i-1]*radians)*std::cos(lat[i]*radians)*std::sin(dLon/2)*std::sin(dLon/2);
+		length += 2*std::asin(std::sqrt(a));
+	}
+	this->length = length*earthRadius;
+
+	// area of the polygon on the sphere, summed edge by edge, which is
+	// exact enough for anything much smaller than a hemisphere
+	if (closed && n >= 4){
+		double area = 0;
+		for (size_t i = 1; i < n; i++){
+			area += (lon[i] - lon[i-1])*radians
+				* (2 + std::sin(lat[i-1]*radians) + std::sin(lat[i]*radians));
+		}
+		this->area = std::fabs(area*earthRadius*earthRadius/2);
+	}
+}
+
+GeometryBuilder::GeometryBuilder(const LocationLookup &l, unsigned threads) : locations(l){
+	this->threads = threads;
+}
+
+GeometryBuilder::~GeometryBuilder(){
+
+}
+
+WayGeometry GeometryBuilder::way(const BlockWay &way){
+	WayGeometry geometry;
+
+	size_t n = way.refs(this->refs);
+	if (n == 0)
+		return geometry;
+
+	this->lat.resize(n);
+	this->lon.resize(n);
+	size_t found = this->locations.locations(&this->refs[0], n, &this->lat[0], &this->lon[0]);
+
+	// the ring is only closed if what is left of it still is: both ends
+	// have to be found, and enough nodes for an area between them
+	bool closed = found >= 4 && this->refs[0] == this->refs[n-1]
+		&& !std::isnan(this->lat[0]) && !std::isnan(this->lat[n-1]);
+
+	// close the gaps left by unknown nodes so the geometry loops can run
+	// over the columns as they are
+	if (found < n){
+		size_t k = 0;
+		for (size_t i = 0; i < n; i++){
+			if (!std::isnan(this->lat[i])){
+				this->lat[k] = this->lat[i];
+				this->lon[k] = this->lon[i];
+				k++;
+			}
+		}
+		geometry.missing = n - found;
+	}
+
+	geometry.compute(&this->lat[0], &this->lon[0], found, closed);
+	return geometry;
+}
+
+// gathers the ways of a block as apply() walks them
+struct WayList {
+	WayList(std::vector<BlockWay> &w) : ways(w){}
+	void way(const BlockWay &way){ways.push_back(way);}
+	std::vector<BlockWay> &ways;
+};
+
+void GeometryBuilder::block(const PbfBlock &block, std::vector<WayGeometry> &geometries){
+	this->ways.clear();
+	WayList list(this->ways);
+	apply(block, list);
+	const std::vector<BlockWay> &ways = this->ways;
+	geometries.resize(ways.size());
+
+	if (!this->workers){
+		this->workers.reset(new WorkerPool(this->threads));
+		for (unsigned t = 1; t < this->workers->size(); t++)
+			this->builders.push_back(std::unique_ptr<GeometryBuilder>(new GeometryBuilder(this->locations, 1)));
+	}
+
+	// ways are taken in small batches, which keeps threads from contending
+	// over the counter and still evens out ways of very different lengths
+	static const size_t batch = 64;
+	this->workers->run((ways.size() + batch - 1) / batch, [&](size_t b, unsigned worker){
+		GeometryBuilder &builder = worker == 0 ? *this : *this->builders[worker - 1];
+		size_t end = std::min((b + 1) * batch, ways.size());
+		for (size_t w = b * batch; w < end; w++)
+			geometries[w] = builder.way(ways[w]);
+	});
+}
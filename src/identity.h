@@ -0,0 +1,33 @@
+#ifndef LIBOSMPBF_IDENTITY_H
+#define LIBOSMPBF_IDENTITY_H
+
+#include <sys/stat.h>
+#include <stdint.h>
+
+namespace libosmpbf {
+
+// Tells a file apart from other files and from earlier versions of itself,
+// for the block cache and for column sidecars: device, inode, modification
+// time to the nanosecond and size. A file rewritten in place keeps its
+// inode, but not its size and mtime. Only regular files can be told apart
+// once they are closed, so for anything else this returns false and leaves
+// id alone.
+inline bool fileIdentity(const struct stat &st, uint64_t id[5]){
+	if (!S_ISREG(st.st_mode))
+		return false;
+	id[0] = st.st_dev;
+	id[1] = st.st_ino;
+	id[2] = st.st_mtim.tv_sec;
+	id[3] = st.st_mtim.tv_nsec;
+	id[4] = st.st_size;
+	return true;
+}
+
+inline bool fileIdentity(const char *file, uint64_t id[5]){
+	struct stat st;
+	return file && stat(file, &st) == 0 && fileIdentity(st, id);
+}
+
+} // end namespace
+
+#endif
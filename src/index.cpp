@@ -0,0 +1,341 @@
+#include <algorithm>
+#include <fstream>
+#include <string.h>
+
+#include "protobuf/osm.pb.h"
+#include "libosmpbf.h"
+using namespace libosmpbf;
+
+// identifies index files written by BlockIndex::save. Entries are stored in
+// host byte order, so index files are not portable across architectures.
+static const char indexMagic[8] = {'O','S','M','P','B','F','I','1'};
+
+BlockIndexEntry::BlockIndexEntry(){
+	offset = 0;
+	for (int t = 0; t < 3; t++){
+		minId[t] = UINT64_MAX;
+		maxId[t] = 0;
+	}
+}
+
+bool BlockIndexEntry::has(MemberType type) const {
+	return minId[type] <= maxId[type];
+}
+
+static void extend(BlockIndexEntry &entry, MemberType type, uint64_t id){
+	if (id < entry.minId[type])
+		entry.minId[type] = id;
+	if (id > entry.maxId[type])
+		entry.maxId[type] = id;
+}
+
+void BlockIndexEntry::add(const OSMPBF::PrimitiveBlock &b){
+	for (int g = 0; g < b.primitivegroup_size(); g++){
+		const OSMPBF::PrimitiveGroup &group = b.primitivegroup(g);
+
+		// dense ids are delta coded, so they have to be summed to find the
+		// range even though the group is usually sorted
+		DenseCursor dense(group.dense(), 0);
+		while (dense.next())
+			extend(*this, Member_Node, dense.id);
+
+		for (int i = 0; i < group.nodes_size(); i++)
+			extend(*this, Member_Node, group.nodes(i).id());
+		for (int i = 0; i < group.ways_size(); i++)
+			extend(*this, Member_Way, group.ways(i).id());
+		for (int i = 0; i < group.relations_size(); i++)
+			extend(*this, Member_Relation, group.relations(i).id());
+	}
+}
+
+// orders block indexes by the first id of a given type they contain
+struct MinIdLess {
+	MinIdLess(const std::vector<BlockIndexEntry> &e, MemberType t) : entries(e), type(t){}
+	bool operator () (size_t a, size_t b) const {return entries[a].minId[type] < entries[b].minId[type];}
+	const std::vector<BlockIndexEntry> &entries;
+	MemberType type;
+};
+
+// compares an id against the first id of a given type in a block
+struct IdBefore {
+	IdBefore(const std::vector<BlockIndexEntry> &e, MemberType t) : entries(e), type(t){}
+	bool operator () (uint64_t id, size_t b) const {return id < entries[b].minId[type];}
+	const std::vector<BlockIndexEntry> &entries;
+	MemberType type;
+};
+
+BlockIndex::BlockIndex(){
+
+}
+
+bool BlockIndex::build(const char *file){
+
+	entries.clear();
+
+	PbfStream pbf(file);
+	if (!pbf)
+		return false;
+
+	PbfBlock block;
+	for (;;){
+		std::streampos offset = pbf.tellg();
+		if (!(pbf >> block))
+			break;
+
+		BlockIndexEntry entry;
+		entry.offset = offset;
+		entry.add(*block.block);
+		entries.push_back(entry);
+	}
+
+	if (pbf.bad()){
+		entries.clear();
+		return false;
+	}
+
+	sort();
+	return true;
+}
+
+bool BlockIndex::load(const char *file){
+
+	entries.clear();
+
+	std::ifstream in(file, std::ios_base::binary);
+	char magic[sizeof(indexMagic)];
+	uint64_t count;
+	if (!in.read(magic, sizeof(magic)) || memcmp(magic, indexMagic, sizeof(magic)) != 0)
+		return false;
+	if (!in.read((char*)&count, sizeof(count)))
+		return false;
+
+	for (uint64_t n = 0; n < count; n++){
+		BlockIndexEntry entry;
+		in.read((char*)&entry.offset, sizeof(entry.offset));
+		in.read((char*)entry.minId, sizeof(entry.minId));
+		in.read((char*)entry.maxId, sizeof(entry.maxId));
+		if (!in){
+			entries.clear();
+			return false;
+		}
+		entries.push_back(entry);
+	}
+
+	sort();
+	return true;
+}
+
+bool BlockIndex::save(const char *file) const {
+
+	std::ofstream out(file, std::ios_base::binary | std::ios_base::trunc);
+	uint64_t count = entries.size();
+	out.write(indexMagic, sizeof(indexMagic));
+	out.write((const char*)&count, sizeof(count));
+
+	for (size_t n = 0; n < entries.size(); n++){
+		const BlockIndexEntry &entry = entries[n];
+		out.write((const char*)&entry.offset, sizeof(entry.offset));
+		out.write((const char*)entry.minId, sizeof(entry.minId));
+		out.write((const char*)entry.maxId, sizeof(entry.maxId));
+	}
+
+	return (bool)out;
+}
+
+size_t BlockIndex::blocks() const {
+	return entries.size();
+}
+
+const BlockIndexEntry &BlockIndex::block(size_t i) const {
+	return entries[i];
+}
+
+void BlockIndex::find(MemberType type, uint64_t id, std::vector<size_t> &blocks) const {
+
+	const std::vector<size_t> &o = order[type];
+	const std::vector<uint64_t> &r = reach[type];
+
+	// every block from here on starts after id
+	size_t n = std::upper_bound(o.begin(), o.end(), id, IdBefore(entries, type)) - o.begin();
+
+	// walk back only as far as some earlier block can still reach id
+	while (n > 0 && r[n-1] >= id){
+		n--;
+		if (entries[o[n]].maxId[type] >= id)
+			blocks.push_back(o[n]);
+	}
+}
+
+void BlockIndex::sort(){
+	for (int t = 0; t < 3; t++){
+		MemberType type = (MemberType)t;
+		order[t].clear();
+		reach[t].clear();
+
+		for (size_t n = 0; n < entries.size(); n++){
+			if (entries[n].has(type))
+				order[t].push_back(n);
+		}
+
+		std::stable_sort(order[t].begin(), order[t].end(), MinIdLess(entries, type));
+
+		uint64_t max = 0;
+		for (size_t n = 0; n < order[t].size(); n++){
+			max = std::max(max, entries[order[t][n]].maxId[t]);
+			reach[t].push_back(max);
+		}
+	}
+}
+
+// clones every object whose id is in the sorted list of wanted ids, none of
+// which may be in out yet, stopping once all of them have been found
+template <typename Iterator, typename T>
+static size_t collect(Iterator i, Iterator end, const std::vector<uint64_t> &want, std::map<uint64_t, T> &out){
+	size_t found = 0;
+	for (; i != end && found < want.size(); i.next()){
+		uint64_t id = (*i).id();
+		if (std::binary_search(want.begin(), want.end(), id) && out.find(id) == out.end()){
+			out.insert(std::make_pair(id, (*i).clone()));
+			found++;
+		}
+	}
+	return found;
+}
+
+static size_t collect(PbfBlock &block, const std::vector<uint64_t> &want, std::map<uint64_t, Node> &out){
+	return collect(block.nodesBegin(), block.nodesEnd(), want, out);
+}
+
+static size_t collect(PbfBlock &block, const std::vector<uint64_t> &want, std::map<uint64_t, Way> &out){
+	return collect(block.waysBegin(), block.waysEnd(), want, out);
+}
+
+static size_t collect(PbfBlock &block, const std::vector<uint64_t> &want, std::map<uint64_t, Relation> &out){
+	return collect(block.relationsBegin(), block.relationsEnd(), want, out);
+}
+
+IdLookup::IdLookup(const char *file, const BlockIndex &i, size_t cacheBlocks, BlockCache *cache) : stream(file), index(i){
+	// at least the block being searched has to be held
+	this->cacheBlocks = cacheBlocks > 0 ? cacheBlocks : 1;
+	stream.setCache(cache);
+}
+
+IdLookup::~IdLookup(){
+	for (BlockList::iterator b = lru.begin(); b != lru.end(); b++)
+		delete b->second;
+}
+
+IdLookup::operator bool () const {
+	return !stream.bad() && stream.is_open();
+}
+
+bool IdLookup::node(uint64_t id, Node &node){
+	std::map<uint64_t, Node> out;
+	if (nodes(std::vector<uint64_t>(1, id), out) == 0)
+		return false;
+	node = out.begin()->second;
+	return true;
+}
+
+bool IdLookup::way(uint64_t id, Way &way){
+	std::map<uint64_t, Way> out;
+	if (ways(std::vector<uint64_t>(1, id), out) == 0)
+		return false;
+	way = out.begin()->second;
+	return true;
+}
+
+bool IdLookup::relation(uint64_t id, Relation &relation){
+	std::map<uint64_t, Relation> out;
+	if (relations(std::vector<uint64_t>(1, id), out) == 0)
+		return false;
+	relation = out.begin()->second;
+	return true;
+}
+
+size_t IdLookup::nodes(const std::vector<uint64_t> &ids, std::map<uint64_t, Node> &out){
+	return lookup(Member_Node, ids, out);
+}
+
+size_t IdLookup::ways(const std::vector<uint64_t> &ids, std::map<uint64_t, Way> &out){
+	return lookup(Member_Way, ids, out);
+}
+
+size_t IdLookup::relations(const std::vector<uint64_t> &ids, std::map<uint64_t, Relation> &out){
+	return lookup(Member_Relation, ids, out);
+}
+
+template <typename T>
+size_t IdLookup::lookup(MemberType type, const std::vector<uint64_t> &ids, std::map<uint64_t, T> &out){
+
+	// ids already in out count as found and are not looked up again
+	std::vector<uint64_t> sorted(ids);
+	std::sort(sorted.begin(), sorted.end());
+	sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+	// group the ids by the blocks which may hold them. Blocks are visited
+	// in file order, so reads stay sequential for large batches.
+	size_t found = 0;
+	std::map<size_t, std::vector<uint64_t> > batches;
+	std::vector<size_t> blocks;
+	for (size_t n = 0; n < sorted.size(); n++){
+		if (out.find(sorted[n]) != out.end()){
+			found++;
+			continue;
+		}
+		blocks.clear();
+		index.find(type, sorted[n], blocks);
+		for (size_t b = 0; b < blocks.size(); b++)
+			batches[blocks[b]].push_back(sorted[n]);
+	}
+
+	std::vector<uint64_t> want;
+	for (typename std::map<size_t, std::vector<uint64_t> >::iterator batch = batches.begin(); batch != batches.end(); batch++){
+
+		// an id may fall in the range of several blocks; drop those an
+		// earlier block held, and skip the block if none are left
+		want.clear();
+		for (size_t n = 0; n < batch->second.size(); n++){
+			if (out.find(batch->second[n]) == out.end())
+				want.push_back(batch->second[n]);
+		}
+		if (want.empty())
+			continue;
+
+		PbfBlock *block = getBlock(batch->first);
+		if (block)
+			found += collect(*block, want, out);
+	}
+
+	return found;
+}
+
+PbfBlock *IdLookup::getBlock(size_t b){
+
+	std::map<size_t, BlockList::iterator>::iterator c = cached.find(b);
+	if (c != cached.end()){
+		lru.splice(lru.begin(), lru, c->second);
+		return c->second->second;
+	}
+
+	// reuse the least recently used block once the cache is full
+	PbfBlock *block;
+	if (lru.size() >= cacheBlocks){
+		block = lru.back().second;
+		cached.erase(lru.back().first);
+		lru.pop_back();
+	} else {
+		block = new PbfBlock;
+	}
+
+	stream.clear();
+	stream.seekg(index.block(b).offset);
+	if (!(stream >> *block)){
+		delete block;
+		return NULL;
+	}
+
+	lru.push_front(std::make_pair(b, block));
+	cached[b] = lru.begin();
+	return block;
+}
@@ -1,29 +1,97 @@
 #include <zlib.h>
 #include <netinet/in.h>
+#include <sys/stat.h>
 #include <stdint.h>
+#include <time.h>
 #include <fstream>
 #include <iostream>
 
 #include "protobuf/osm.pb.h"
 #include "libosmpbf.h"
+#include "readahead.h"
+#include "source.h"
+#include "identity.h"
 using namespace libosmpbf;
 
+// statements which only update PbfStats, and vanish unless they are kept
+#ifdef LIBOSMPBF_STATS
+#define STATS(x) x
+#else
+#define STATS(x)
+#endif
+
+static inline uint64_t nanoseconds(){
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec*1000000000ULL + t.tv_nsec;
+}
+
+#ifdef LIBOSMPBF_STATS
+// notes when a block is handed back to the caller, however it is left
+struct StatsReturn {
+	StatsReturn(uint64_t &r) : returned(r){}
+	~StatsReturn(){returned = nanoseconds();}
+	uint64_t &returned;
+};
+
+static void countObjects(PbfStats &stats, const OSMPBF::PrimitiveBlock &block){
+	for (int g = 0; g < block.primitivegroup_size(); g++){
+		const OSMPBF::PrimitiveGroup &group = block.primitivegroup(g);
+		stats.nodes += group.dense().id_size() + group.nodes_size();
+		stats.ways += group.ways_size();
+		stats.relations += group.relations_size();
+	}
+}
+#endif
+
 Coords::Coords(){
 	this->lat = this->lon = 0;
 }
 
 // lat/lon coordinates are stored in PBF files as integers, and getting lat/lon values
-// requires conversion using the specified granularity of the relevant block
-Coords::Coords(int64_t lat, int64_t lon, int32_t granularity){
-	this->lat = lat*granularity/1000000000.0;
-	this->lon = lon*granularity/1000000000.0;
+// requires conversion using the specified granularity and offsets of the relevant block
+Coords::Coords(int64_t lat, int64_t lon, int32_t granularity, int64_t latOffset, int64_t lonOffset){
+	this->lat = (latOffset + lat*granularity)/1000000000.0;
+	this->lon = (lonOffset + lon*granularity)/1000000000.0;
+}
+
+Info::Info(){
+	version = -1;
+	timestamp = changeset = 0;
+	uid = 0;
+}
+
+Info::Info(const BlockInfo &info) : user(info.user){
+	version = info.version;
+	timestamp = info.timestamp;
+	changeset = info.changeset;
+	uid = info.uid;
+}
+
+BlockInfo::BlockInfo(int32_t version, int64_t timestamp, int64_t changeset, int32_t uid, const std::string &user) : user(user){
+	this->version = version;
+	this->timestamp = timestamp;
+	this->changeset = changeset;
+	this->uid = uid;
+}
+
+// user for objects without metadata
+static const std::string noUser;
+
+// timestamps are stored in units of the block's date granularity, which is
+// given in milliseconds
+static BlockInfo blockInfo(const OSMPBF::PrimitiveBlock &block, const OSMPBF::Info &info, bool present){
+	if (!present)
+		return BlockInfo(-1, 0, 0, 0, noUser);
+	return BlockInfo(info.version(), info.timestamp()*block.date_granularity()/1000,
+		info.changeset(), info.uid(), block.stringtable().s(info.user_sid()));
 }
 
 Node::Node(){
 	id = 0;
 }
 
-Node::Node(const BlockNode &n) : coords(n.coords()) {
+Node::Node(const BlockNode &n) : coords(n.coords()), info(n.info()) {
 	id = n.id();
 
 	for (int i = 0; i < n.tags(); i++){
@@ -36,12 +104,12 @@ Way::Way(){
 	id = 0;
 }
 
-Way::Way(const BlockWay &w){
+Way::Way(const BlockWay &w) : info(w.info()) {
 	id = w.id();
 
-	for (int i = 0; i < w.nodes(); i++){
-		nodeIds.push_back(w.nodes(i));
-	}
+	std::vector<uint64_t> refs;
+	w.refs(refs);
+	nodeIds.assign(refs.begin(), refs.end());
 
 	for (int i = 0; i < w.tags(); i++){
 		BlockTag tag = w.tags(i);
@@ -60,7 +128,7 @@ Relation::Relation(){
 	id = 0;
 }
 
-Relation::Relation(const BlockRelation &r){
+Relation::Relation(const BlockRelation &r) : info(r.info()) {
 	id = r.id();
 
 	for (int i = 0; i < r.tags(); i++){
@@ -84,10 +152,6 @@ const char *Relation::getTag(const char *name) const {
 		return NULL;
 }
 
-BlockWay::BlockWay(const OSMPBF::Way &w, const OSMPBF::PrimitiveBlock &b) : way(w), block(b){
-
-}
-
 uint64_t BlockWay::id() const {return way.id();}
 
 int BlockWay::tags() const {return way.keys_size();}
@@ -110,28 +174,25 @@ uint64_t BlockWay::nodes(int i) const {
 	return node;
 }
 
-BlockNode::BlockNode(const OSMPBF::PrimitiveBlock &b, int group, int i, uint64_t idBase, uint64_t node, int64_t lat, int64_t lon) : block(b){
-	this->dense = true;
-	this->group = group;
-	this->i = i;
-	this->idBase = idBase;
-	this->node = node;
-	this->lat = lat;
-	this->lon = lon;
+size_t BlockWay::refs(std::vector<uint64_t> &ids) const {
+	int n = way.refs_size();
+	ids.resize(n);
+
+	int64_t node = 0;
+	for (int i = 0; i < n; i++){
+		node += way.refs(i);
+		ids[i] = node;
+	}
+	return n;
 }
 
-BlockNode::BlockNode(const OSMPBF::PrimitiveBlock &b, int group, int i) : block(b){
-	this->dense = false;
-	this->group = group;
-	this->i = i;
-	this->idBase = 0;
-	this->node = 0;
+BlockInfo BlockWay::info() const {
+	return blockInfo(block, way.info(), way.has_info());
 }
 
 uint64_t BlockNode::id() const {
 	if (this->dense){
-		const OSMPBF::DenseNodes &nodes = block.primitivegroup(this->group).dense();
-		return this->idBase+nodes.id(this->node);
+		return this->nodeId;
 	} else {
 		const OSMPBF::Node &n = block.primitivegroup(this->group).nodes(this->i);
 		return n.id();
@@ -164,15 +225,24 @@ BlockTag BlockNode::tags(int x) const {
 
 Coords BlockNode::coords() const {
 	if (dense){
-		return Coords(this->lat,this->lon,this->block.granularity());
+		return Coords(this->lat, this->lon, this->block.granularity(), this->block.lat_offset(), this->block.lon_offset());
 	} else {
 		const OSMPBF::Node &n = block.primitivegroup(this->group).nodes(this->i);
-		return Coords(n.lat(),n.lon(),this->block.granularity());
+		return Coords(n.lat(), n.lon(), this->block.granularity(), this->block.lat_offset(), this->block.lon_offset());
 	}
 }
 
-BlockRelation::BlockRelation(const OSMPBF::Relation &r, const OSMPBF::PrimitiveBlock &b) : relation(r), block(b){
-
+BlockInfo BlockNode::info() const {
+	if (dense){
+		const OSMPBF::DenseInfo &info = block.primitivegroup(this->group).dense().denseinfo();
+		if (this->node >= info.version_size())
+			return BlockInfo(-1, 0, 0, 0, noUser);
+		return BlockInfo(info.version(this->node), this->timestamp*this->block.date_granularity()/1000,
+			this->changeset, this->uid, this->block.stringtable().s(this->userSid));
+	} else {
+		const OSMPBF::Node &n = block.primitivegroup(this->group).nodes(this->i);
+		return blockInfo(this->block, n.info(), n.has_info());
+	}
 }
 
 uint64_t BlockRelation::id() const {
@@ -198,6 +268,10 @@ int BlockRelation::members() const {
 	return relation.memids_size();
 }
 
+BlockInfo BlockRelation::info() const {
+	return blockInfo(block, relation.info(), relation.has_info());
+}
+
 BlockRelation::Member BlockRelation::members(int i) const {
 
 	uint64_t id = 0;
@@ -216,120 +290,120 @@ BlockRelation::Member BlockRelation::members(int i) const {
 	}
 }
 
-PbfBlock::NodeIterator::NodeIterator(OSMPBF::PrimitiveBlock &b, bool end) : block(b){
+PbfBlock::NodeIterator::NodeIterator(const OSMPBF::PrimitiveBlock &b, bool end) : block(b){
 	this->group = 0;
-	this->i = 0;
+	this->node = this->count = 0;
+	this->dense = false;
 	this->end = end;
-	this->dense = true;
-	this->idBase = 0;
-	this->node = 0;
 
-	const OSMPBF::DenseNodes &nodes = block.primitivegroup(group).dense();
-	if (nodes.keys_vals_size() > 0){
-		this->lat = block.lat_offset() + nodes.lat(0);
-		this->lon = block.lon_offset() + nodes.lon(0);
-	}
+	if (!this->end)
+		this->startGroup();
+}
+
+PbfBlock::NodeIterator::NodeIterator(const PbfBlock::NodeIterator &i) : block(i.block){
+	this->group = i.group;
+	this->node = i.node;
+	this->count = i.count;
+	this->dense = i.dense;
+	this->end = i.end;
+	if (i.cursor)
+		this->cursor.reset(new DenseCursor(*i.cursor));
+}
+
+PbfBlock::NodeIterator::~NodeIterator(){
 
-	if (!this->hasData())
-		this->next();
 }
 
 bool PbfBlock::NodeIterator::hasData() const {
-	return this->group < block.primitivegroup_size()
-			&& ((!this->dense && this->i < block.primitivegroup(this->group).nodes_size())
-				|| (
-					this->dense
-					&& block.primitivegroup(this->group).has_dense()
-					&& this->i < block.primitivegroup(this->group).dense().keys_vals_size()
-				));
+	return !this->end;
 }
 
 bool PbfBlock::NodeIterator::operator == (const PbfBlock::NodeIterator &i) const {
 	if (this->end && i.end)
 		return true;
-	return this->end == i.end && this->i == i.i
-		&& this->group == i.group && this->dense == i.dense
-		&& this->node == i.node && this->idBase == i.idBase;
+	return this->end == i.end && this->group == i.group
+		&& this->dense == i.dense && this->node == i.node;
 }
 
 bool PbfBlock::NodeIterator::operator != (const PbfBlock::NodeIterator &i) const {
 	return !(*this == i);
 }
 
-PbfBlock::NodeIterator &PbfBlock::NodeIterator::next(){
+// Moves to the first node of the current group, or of the first group after
+// it that has any.
+void PbfBlock::NodeIterator::startGroup(){
 
-	if (this->end)
-		return *this;
+	for (; this->group < block.primitivegroup_size(); this->group++){
+		const OSMPBF::PrimitiveGroup &g = block.primitivegroup(this->group);
 
-	do {
-		if (this->dense && !block.primitivegroup(group).has_dense())
-			this->dense = false;
+		this->node = 0;
 
-		if (this->dense){
+		if (g.dense().id_size() > 0){
+			this->dense = true;
+			if (this->cursor)
+				*this->cursor = DenseCursor(g.dense());
+			else
+				this->cursor.reset(new DenseCursor(g.dense()));
+			this->cursor->next();
+			this->count = this->cursor->count;
+			return;
+		}
 
-			const OSMPBF::DenseNodes &nodes = block.primitivegroup(group).dense();
+		if (g.nodes_size() > 0){
+			this->dense = false;
+			this->count = g.nodes_size();
+			return;
+		}
+	}
 
-			while (this->i < nodes.keys_vals_size() && nodes.keys_vals(i) != 0){
-				this->i += 2;
-			}
+	this->end = true;
+}
 
-			if (this->i < nodes.keys_vals_size()-1){
-				this->idBase += nodes.id(this->node);
-				this->node++;
-				// ensure i advances past the 0 delimiter
-				this->i++;
+PbfBlock::NodeIterator &PbfBlock::NodeIterator::next(){
 
-				this->lat += nodes.lat(this->node);
-				this->lon += nodes.lon(this->node);
+	if (this->end)
+		return *this;
 
-			} else {
-				this->dense = false;
-				this->i = 0;
-			}
+	if (this->dense){
 
-		} else {
-			if (this->i < block.primitivegroup(this->group).nodes_size()){
-				this->i++;
-			} else if (this->group < block.primitivegroup_size()-1){
-				this->group++;
-				this->i = 0;
-				this->dense = true;
-				this->node = 0;
-				this->idBase = 0;
-
-				const OSMPBF::DenseNodes &nextNodes = block.primitivegroup(group).dense();
-				if (nextNodes.keys_vals_size() > 0){
-					this->lat = block.lat_offset() + nextNodes.lat(0);
-					this->lon = block.lon_offset() + nextNodes.lon(0);
-				}
+		if (this->cursor->next()){
+			this->node = this->cursor->node;
+			return *this;
+		}
 
-			} else {
-				this->end = true;
-			}
+		// a group could hold plain nodes after its dense ones
+		const OSMPBF::PrimitiveGroup &g = block.primitivegroup(this->group);
+		if (g.nodes_size() > 0){
+			this->dense = false;
+			this->node = 0;
+			this->count = g.nodes_size();
+			return *this;
 		}
 
-	} while (!this->end && !this->hasData());
+	} else if (++this->node < this->count){
+		return *this;
+	}
 
+	this->group++;
+	this->startGroup();
 	return *this;
 }
 
 const BlockNode PbfBlock::NodeIterator::operator -> () const {
-	if (this->dense){
-		return BlockNode(this->block, this->group, this->i, this->idBase, this->node, this->lat, this->lon);
-	} else {
-		return BlockNode(this->block, this->group, this->i);
-	}
+	return **this;
 }
 
 const BlockNode PbfBlock::NodeIterator::operator * () const {
 	if (this->dense){
-		return BlockNode(this->block, this->group, this->i, this->idBase, this->node, this->lat, this->lon);
+		const DenseCursor &c = *this->cursor;
+		return BlockNode(this->block, this->group, c.kv, c.id, c.node, c.lat, c.lon,
+			c.timestamp, c.changeset, c.uid, c.userSid);
 	} else {
-		return BlockNode(this->block, this->group, this->i);
+		return BlockNode(this->block, this->group, this->node);
 	}
 }
 
-PbfBlock::WayIterator::WayIterator(OSMPBF::PrimitiveBlock &b, bool end) : block(b){
+PbfBlock::WayIterator::WayIterator(const OSMPBF::PrimitiveBlock &b, bool end) : block(b){
 	this->group = 0;
 	this->i = 0;
 	this->end = end;
@@ -382,7 +456,7 @@ const BlockWay PbfBlock::WayIterator::operator * () const {
 	return BlockWay(block.primitivegroup(this->group).ways(this->i), block);
 }
 
-PbfBlock::RelationIterator::RelationIterator(OSMPBF::PrimitiveBlock &b, bool end) : block(b){
+PbfBlock::RelationIterator::RelationIterator(const OSMPBF::PrimitiveBlock &b, bool end) : block(b){
 	this->group = 0;
 	this->i = 0;
 	this->end = end;
@@ -435,16 +509,53 @@ const BlockRelation PbfBlock::RelationIterator::operator * () const {
 	return BlockRelation(block.primitivegroup(this->group).relations(this->i), block);
 }
 
-PbfBlock::PbfBlock(){
-	block = new OSMPBF::PrimitiveBlock;
+PbfBlock::PbfBlock() : block(new OSMPBF::PrimitiveBlock){
+
 }
 
 PbfBlock::~PbfBlock(){
-	delete block;
+
 }
 
 int PbfBlock::granularity() const {return block->granularity();}
 
+const std::string &PbfBlock::string(uint32_t sid) const {
+	return block->stringtable().s(sid);
+}
+
+void DenseInfoColumns::clear(){
+	id.clear();
+	version.clear();
+	timestamp.clear();
+	changeset.clear();
+	uid.clear();
+	userSid.clear();
+}
+
+size_t PbfBlock::denseInfo(DenseInfoColumns &columns) const {
+
+	columns.clear();
+
+	for (int g = 0; g < block->primitivegroup_size(); g++){
+		DenseCursor c(block->primitivegroup(g).dense(), DenseCursor::Info);
+		while (c.next()){
+			columns.id.push_back(c.id);
+			if (c.hasInfo){
+				columns.version.push_back(c.columns.version[c.node]);
+				columns.timestamp.push_back(c.timestamp*block->date_granularity()/1000);
+			} else {
+				columns.version.push_back(-1);
+				columns.timestamp.push_back(0);
+			}
+			columns.changeset.push_back(c.changeset);
+			columns.uid.push_back(c.uid);
+			columns.userSid.push_back(c.userSid);
+		}
+	}
+
+	return columns.id.size();
+}
+
 int PbfBlock::Nodes() const {
 	return 0;
 }
@@ -493,16 +604,153 @@ Relation BlockRelation::clone() const {
 	return Relation(*this);
 }
 
-PbfStream::PbfStream(const char *file) : std::fstream(file){
+OPbfStream::OPbfStream(const char *file, bool sorted) : std::ofstream(file, std::ios_base::binary | std::ios_base::trunc){
 
 	GOOGLE_PROTOBUF_VERIFY_VERSION;
 
+	OSMPBF::HeaderBlock headerBlock;
+	headerBlock.add_required_features("OsmSchema-V0.6");
+	headerBlock.add_required_features("DenseNodes");
+	if (sorted)
+		headerBlock.add_optional_features("Sort.Type_then_ID");
+	headerBlock.set_writingprogram("libosmpbf");
+
+	std::string data;
+	if (!headerBlock.SerializeToString(&data))
+		this->setstate(std::ios_base::badbit);
+	else
+		writeBlob("OSMHeader", data);
+}
+
+OPbfStream::~OPbfStream(){
+
+}
+
+std::ostream &OPbfStream::operator << (PbfBlock &block){
+	std::string data;
+	if (!block.block->SerializeToString(&data))
+		this->setstate(std::ios_base::badbit);
+	else
+		writeBlob("OSMData", data);
+	return *this;
+}
+
+std::ostream &OPbfStream::writeBlob(const std::string &type, const std::string &data){
+
+	uLongf zsize = compressBound(data.size());
+	std::string zdata(zsize, '\0');
+	if (compress((Bytef*)&zdata[0], &zsize, (const Bytef*)data.data(), data.size()) != Z_OK){
+		std::cerr << "Unable to compress block\n";
+		this->setstate(std::ios_base::badbit);
+		return *this;
+	}
+	zdata.resize(zsize);
+
 	OSMPBF::Blob blob;
-	readBlob(*this, blob);
+	blob.set_raw_size(data.size());
+	blob.set_zlib_data(zdata);
+
+	std::string blobData;
+	blob.SerializeToString(&blobData);
 
-	if (*this){
+	OSMPBF::BlobHeader blobHeader;
+	blobHeader.set_type(type);
+	blobHeader.set_datasize(blobData.size());
+
+	std::string headerData;
+	blobHeader.SerializeToString(&headerData);
+
+	unsigned int blobHeaderSize = htonl(headerData.size());
+	this->write((const char*)&blobHeaderSize, sizeof(blobHeaderSize));
+	this->write(headerData.data(), headerData.size());
+	this->write(blobData.data(), blobData.size());
+	return *this;
+}
+
+PbfStats::PbfStats(){
+	readNs = inflateNs = parseNs = userNs = 0;
+	bytesRead = bytesInflated = 0;
+	blocks = cacheHits = 0;
+	nodes = ways = relations = 0;
+	allocations = 0;
+	queued = stalls = 0;
+}
+
+bool PbfStats::enabled(){
+#ifdef LIBOSMPBF_STATS
+	return true;
+#else
+	return false;
+#endif
+}
+
+void PbfStats::json(std::ostream &out) const {
+	out << "{\"enabled\": " << (enabled() ? "true" : "false")
+		<< ", \"readNs\": " << readNs
+		<< ", \"inflateNs\": " << inflateNs
+		<< ", \"parseNs\": " << parseNs
+		<< ", \"userNs\": " << userNs
+		<< ", \"bytesRead\": " << bytesRead
+		<< ", \"bytesInflated\": " << bytesInflated
+		<< ", \"blocks\": " << blocks
+		<< ", \"cacheHits\": " << cacheHits
+		<< ", \"nodes\": " << nodes
+		<< ", \"ways\": " << ways
+		<< ", \"relations\": " << relations
+		<< ", \"allocations\": " << allocations
+		<< ", \"queued\": " << queued
+		<< ", \"stalls\": " << stalls
+		<< "}";
+}
+
+PbfStream::PbfStream(const char *file) : std::fstream(file){
+	this->init();
+	this->path = file;
+	this->identified = fileIdentity(file, this->fileId);
+
+	readHeaderBlock();
+}
+
+PbfStream::PbfStream(int fd){
+	this->init();
+	this->source.reset(new FdSource(fd));
+	std::ios::rdbuf(this->source.get());
+
+	struct stat st;
+	if (fstat(fd, &st) == 0)
+		this->identified = fileIdentity(st, this->fileId);
+
+	readHeaderBlock();
+}
+
+PbfStream::PbfStream(const char *data, size_t size){
+	this->init();
+	this->span = new SpanSource(data, size);
+	this->source.reset(this->span);
+	std::ios::rdbuf(this->source.get());
+
+	// a span is never cached, as nothing tells when its memory is reused
+	readHeaderBlock();
+}
+
+void PbfStream::init(){
+
+	GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+	this->cache = NULL;
+	this->span = NULL;
+	this->readAheadBlobs = 0;
+	this->returned = 0;
+	this->identified = false;
+}
+
+void PbfStream::readHeaderBlock(){
+	OSMPBF::BlobHeader blobHeader;
+	std::string buffer;
+	const char *data;
+	if (readBlobHeader(*this, blobHeader) && readBlobBytes(blobHeader.datasize(), buffer, data)){
 		OSMPBF::HeaderBlock headerBlock;
-		if (!getCompressedBlock(blob, headerBlock))
+		if (!readBlock(data, blobHeader.datasize(), headerBlock))
 			this->setstate(std::ios_base::badbit);
 		else {
 			/*std::cout << "Required features:\n";
@@ -511,14 +759,13 @@ PbfStream::PbfStream(const char *file) : std::fstream(file){
 			}*/
 		}
 	}
-	
 }
 
-// Read blobs without decompressing them
+// Skip blobs without reading their data
 std::fstream &PbfStream::skipBlocks(unsigned long n){	
-	OSMPBF::Blob blob;
-	while (n > 0 && *this){
-		readBlob(*this, blob);
+	OSMPBF::BlobHeader blobHeader;
+	while (n > 0 && readBlobHeader(*this, blobHeader)){
+		this->seekg(blobHeader.datasize(), std::ios_base::cur);
 		n--;
 	}
 	return *this;
@@ -528,47 +775,122 @@ PbfStream::~PbfStream(){
 
 }
 
+void PbfStream::setCache(BlockCache *cache){
+	this->cache = cache;
+}
+
+void PbfStream::setReadAhead(unsigned blobs){
+	this->readAheadBlobs = blobs;
+	this->readAhead.reset();
+}
+
+const PbfStats &PbfStream::stats() const {
+	return this->counters;
+}
+
+void PbfStream::resetStats(){
+	this->counters = PbfStats();
+	this->returned = 0;
+}
+
 std::fstream &PbfStream::operator >> (PbfBlock &block){
 
-	OSMPBF::Blob blob;
-	readBlob(*this, blob);
-	
-	if (!getCompressedBlock(blob, *block.block))
+	STATS(
+		if (this->returned)
+			this->counters.userNs += nanoseconds() - this->returned;
+		StatsReturn statsReturn(this->returned);
+	)
+
+	uint64_t offset = this->tellg();
+
+	BlockCache *cache = this->identified ? this->cache : NULL;
+	BlockCache::Key key;
+	if (cache){
+		for (int n = 0; n < 5; n++)
+			key.file[n] = this->fileId[n];
+		key.offset = offset;
+	}
+
+	OSMPBF::BlobHeader blobHeader;
+	std::string buffer;
+	bool readingAhead = this->readAheadBlobs > 0 && !this->path.empty() && *this;
+	if (readingAhead){
+		if (!readAheadBlob(offset, buffer))
+			return *this;
+	} else if (!readBlobHeader(*this, blobHeader))
+		return *this;
+
+	// cached blocks are shared as is, and the blob itself is never parsed
+	if (cache){
+		BlockCache::BlockPtr cached = cache->get(key);
+		if (cached){
+			if (!readingAhead)
+				this->seekg(blobHeader.datasize(), std::ios_base::cur);
+			block.block = cached;
+			STATS(
+				this->counters.blocks++;
+				this->counters.cacheHits++;
+				countObjects(this->counters, *block.block);
+			)
+			return *this;
+		}
+	}
+
+	const char *data = buffer.data();
+	size_t size = buffer.size();
+	if (!readingAhead){
+		size = blobHeader.datasize();
+		if (!readBlobBytes(size, buffer, data))
+			return *this;
+	}
+
+	// never parse over a block that is also held by a cache
+	if (block.block.use_count() != 1)
+		block.block.reset(new OSMPBF::PrimitiveBlock);
+
+	if (!readBlock(data, size, *block.block)){
 		this->setstate(std::ios_base::badbit);
+		return *this;
+	}
+
+	if (cache)
+		cache->put(key, block.block);
+
+	STATS(
+		this->counters.blocks++;
+		countObjects(this->counters, *block.block);
+	)
 
 	return *this;
 }
 
 std::fstream &PbfStream::readDataStr(std::fstream &in, std::string &str, size_t size){
+	STATS(uint64_t start = nanoseconds());
 	char *data = new char[size];
 	in.read(data, size);
 	if (in)
 		str.assign(data, size);
 	delete[] data;
+	STATS(
+		this->counters.readNs += nanoseconds() - start;
+		this->counters.bytesRead += in.gcount();
+		this->counters.allocations += 2;
+	)
 	return in;
 }
 
-std::fstream &PbfStream::readBlob(std::fstream &in, OSMPBF::Blob &blob){
-	OSMPBF::BlobHeader blobHeader;
+std::fstream &PbfStream::readBlobHeader(std::fstream &in, OSMPBF::BlobHeader &blobHeader){
 	unsigned int blobHeaderSize;
-	if (in.read((char*)&blobHeaderSize, sizeof(blobHeaderSize))){
+	STATS(uint64_t start = nanoseconds());
+	in.read((char*)&blobHeaderSize, sizeof(blobHeaderSize));
+	STATS(
+		this->counters.readNs += nanoseconds() - start;
+		this->counters.bytesRead += in.gcount();
+	)
+	if (in){
 		blobHeaderSize = ntohl(blobHeaderSize);
-		try {
-			std::string data;
-			if (!readDataStr(in, data, blobHeaderSize)){
-				in.setstate(std::ios_base::badbit);
-				return in;
-			}
-
-			if (!blobHeader.ParseFromString(data))
-				throw "Failed to parse from string";
-			if (!readDataStr(in, data, blobHeader.datasize()))
-				throw "Unable to read data";
-			if (!blob.ParseFromString(data))
-				throw "Failed to parse";
-
-		} catch (const char *s){
-			std::cerr << s << "\n";
+		if (!readMessage(in, blobHeader, blobHeaderSize)){
+			std::cerr << "Failed to parse from string\n";
 			in.setstate(std::ios_base::badbit);
 			return in;
 		}
@@ -577,7 +899,87 @@ std::fstream &PbfStream::readBlob(std::fstream &in, OSMPBF::Blob &blob){
 	return in;
 }
 
-bool PbfStream::inflate(std::string data, unsigned char *buf, size_t bufSz){
+// parses the next size bytes as message; memory spans are parsed from
+// where they lie rather than being read out first
+template <typename T>
+bool PbfStream::readMessage(std::fstream &in, T &message, size_t size){
+	if (this->span && &in == this){
+		if (this->span->available() < size){
+			in.setstate(std::ios_base::eofbit | std::ios_base::failbit);
+			return false;
+		}
+		bool parsed = message.ParseFromArray(this->span->current(), size);
+		this->span->advance(size);
+		STATS(this->counters.bytesRead += size);
+		return parsed;
+	}
+
+	std::string data;
+	if (!readDataStr(in, data, size))
+		return false;
+	return message.ParseFromString(data);
+}
+
+// reads the next size bytes of a blob. A span is not read out at all: data
+// points into it. Anything else is read into buffer, which data points to.
+bool PbfStream::readBlobBytes(size_t size, std::string &buffer, const char *&data){
+	if (this->span){
+		if (this->span->available() < size){
+			this->setstate(std::ios_base::eofbit | std::ios_base::failbit);
+			return false;
+		}
+		data = this->span->current();
+		this->span->advance(size);
+		STATS(this->counters.bytesRead += size);
+		return true;
+	}
+
+	if (!readDataStr(*this, buffer, size))
+		return false;
+	data = buffer.data();
+	return true;
+}
+
+// takes the data of the blob at offset from the read-ahead, starting it
+// over there if the stream has moved since, and leaves the stream after the
+// blob as reading it directly would
+bool PbfStream::readAheadBlob(uint64_t offset, std::string &data){
+	STATS(uint64_t start = nanoseconds());
+
+	if (!this->readAhead || this->readAhead->offset() != offset){
+		this->readAhead.reset(new ReadAhead(this->path.c_str(), offset, this->readAheadBlobs));
+		if (!this->readAhead->ok()){
+			std::cerr << "Unable to read ahead in " << this->path << "\n";
+			this->readAhead.reset();
+			this->setstate(std::ios_base::badbit);
+			return false;
+		}
+	}
+
+	Frame frame;
+	size_t queued;
+	if (!this->readAhead->next(frame, queued)){
+		if (this->readAhead->failed())
+			this->setstate(std::ios_base::badbit);
+		else
+			this->setstate(std::ios_base::eofbit | std::ios_base::failbit);
+		return false;
+	}
+
+	this->seekg(frame.end);
+	data.swap(frame.data);
+
+	STATS(
+		this->counters.readNs += nanoseconds() - start;
+		this->counters.bytesRead += frame.end - frame.offset;
+		this->counters.queued += queued;
+		if (queued == 0)
+			this->counters.stalls++;
+	)
+	return true;
+}
+
+bool PbfStream::inflate(const char *data, size_t size, unsigned char *buf, size_t bufSz){
 	z_stream zstrm;
 	zstrm.zalloc = Z_NULL;
 	zstrm.zfree = Z_NULL;
@@ -589,8 +991,8 @@ bool PbfStream::inflate(std::string data, unsigned char *buf, size_t bufSz){
 		return false;
 	}
 
-	zstrm.avail_in = data.capacity();
-	zstrm.next_in = (Bytef*)data.data();
+	zstrm.avail_in = size;
+	zstrm.next_in = (Bytef*)data;
 	zstrm.avail_out = bufSz;
 	zstrm.next_out = buf;
 	int r = ::inflate(&zstrm, Z_NO_FLUSH);
@@ -603,25 +1005,135 @@ bool PbfStream::inflate(std::string data, unsigned char *buf, size_t bufSz){
 	return true;
 }
 
-template <typename T>
-bool PbfStream::getCompressedBlock(OSMPBF::Blob &blob, T &block){
-	try {
-		if (blob.has_zlib_data()){
-
-			unsigned char *buf = new unsigned char[blob.raw_size()];
-			if (!inflate(blob.zlib_data(), buf, blob.raw_size()))
-				throw "Unable to decompress zlib data";
-
-			std::string datastr((char*)buf, blob.raw_size());
-			if (!block.ParseFromString(datastr)){
-				throw "Cannot parse block";
+// where the compressed data of a serialized Blob lies. Parsing the Blob
+// would copy its data out into a string, so its fields are only walked.
+struct BlobData {
+	const char *zlib;
+	uint32_t zlibSize, rawSize;
+};
+
+static bool findBlobData(const char *data, size_t size, BlobData &blob){
+	blob.zlib = NULL;
+	blob.zlibSize = blob.rawSize = 0;
+
+	google::protobuf::io::CodedInputStream in((const uint8_t*)data, size);
+	uint32_t tag;
+	while ((tag = in.ReadTag()) != 0){
+		int field = tag >> 3;
+		uint64_t value;
+		uint32_t length;
+		switch (tag & 7){
+		case 0: // varint
+			if (!in.ReadVarint64(&value))
+				return false;
+			if (field == OSMPBF::Blob::kRawSizeFieldNumber)
+				blob.rawSize = value;
+			break;
+		case 1: // fixed64
+			if (!in.Skip(8))
+				return false;
+			break;
+		case 2: // length delimited
+			if (!in.ReadVarint32(&length))
+				return false;
+			if (field == OSMPBF::Blob::kZlibDataFieldNumber){
+				blob.zlib = data + in.CurrentPosition();
+				blob.zlibSize = length;
 			}
-			delete[] buf;
+			if (!in.Skip(length))
+				return false;
+			break;
+		case 5: // fixed32
+			if (!in.Skip(4))
+				return false;
+			break;
+		default:
+			return false;
 		}
-	} catch (const char *s){
-		std::cerr << s << "\n";
+	}
+	return (size_t)in.CurrentPosition() == size;
+}
+
+// decodes the serialized Blob of size bytes at data into block, inflating
+// its zlib data where it lies
+template <typename T>
+bool PbfStream::readBlock(const char *data, size_t size, T &block){
+	BlobData blob;
+	if (!findBlobData(data, size, blob)){
+		std::cerr << "Failed to parse\n";
 		return false;
 	}
 
+	// a blob without data is read as an empty block, rather than leaving
+	// whatever block was parsed into last
+	if (!blob.zlib){
+		block.Clear();
+		return true;
+	}
+
+	STATS(uint64_t start = nanoseconds());
+	std::unique_ptr<unsigned char[]> buf(new unsigned char[blob.rawSize]);
+	if (!inflate(blob.zlib, blob.zlibSize, buf.get(), blob.rawSize)){
+		std::cerr << "Unable to decompress zlib data\n";
+		return false;
+	}
+	STATS(
+		uint64_t inflated = nanoseconds();
+		this->counters.inflateNs += inflated - start;
+		this->counters.bytesInflated += blob.rawSize;
+		this->counters.allocations++;
+	)
+
+	if (!block.ParseFromArray(buf.get(), blob.rawSize)){
+		std::cerr << "Cannot parse block\n";
+		return false;
+	}
+	STATS(this->counters.parseNs += nanoseconds() - inflated);
 	return true;
 }
+
+// the columns of a DenseNodes group; a column that is empty has no data,
+// so DenseInfo is only passed on when every node has all of it
+static DenseColumns denseColumns(const OSMPBF::DenseNodes &dense){
+	DenseColumns c;
+	c.count = dense.id_size();
+	c.id = dense.id().data();
+	c.lat = dense.lat().data();
+	c.lon = dense.lon().data();
+	c.keysValsSize = dense.keys_vals_size();
+	c.keysVals = c.keysValsSize > 0 ? dense.keys_vals().data() : NULL;
+
+	const OSMPBF::DenseInfo &info = dense.denseinfo();
+	if (c.count > 0 && info.version_size() == c.count && info.timestamp_size() == c.count
+			&& info.changeset_size() == c.count && info.uid_size() == c.count && info.user_sid_size() == c.count){
+		c.version = info.version().data();
+		c.timestamp = info.timestamp().data();
+		c.changeset = info.changeset().data();
+		c.uid = info.uid().data();
+		c.userSid = info.user_sid().data();
+	} else {
+		c.version = c.uid = c.userSid = NULL;
+		c.timestamp = c.changeset = NULL;
+	}
+	return c;
+}
+
+DenseCursor::DenseCursor(const OSMPBF::DenseNodes &dense, int fields) : DenseCursor(denseColumns(dense), fields){
+
+}
+
+int PbfBlock::groups() const {
+	return block->primitivegroup_size();
+}
+
+void PbfBlock::group(int g, BlockGroup &group) const {
+	const OSMPBF::PrimitiveGroup &p = block->primitivegroup(g);
+	group.block = block.get();
+	group.index = g;
+	group.dense = denseColumns(p.dense());
+	group.nodes = p.nodes_size();
+	group.ways = p.ways_size();
+	group.way = p.ways().data();
+	group.relations = p.relations_size();
+	group.relation = p.relations().data();
+}
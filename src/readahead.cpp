@@ -0,0 +1,428 @@
+#include <fcntl.h>
+#include <unistd.h>
+#include <string.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <iostream>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#define HAVE_IO_URING
+#endif
+#endif
+
+#include "protobuf/osm.pb.h"
+#include "libosmpbf.h"
+#include "readahead.h"
+using namespace libosmpbf;
+
+// reads exactly size bytes at offset, unless the file ends first
+static ssize_t preadFully(int fd, char *buf, size_t size, uint64_t offset){
+	size_t done = 0;
+	while (done < size){
+		ssize_t r = pread(fd, buf + done, size - done, offset + done);
+		if (r < 0 && errno == EINTR)
+			continue;
+		if (r < 0)
+			return -1;
+		if (r == 0)
+			break;
+		done += r;
+	}
+	return done;
+}
+
+#ifdef HAVE_IO_URING
+
+// Just enough of io_uring to keep several reads in flight, driven through
+// the system calls directly so that liburing is not needed. Setup fails on
+// kernels without io_uring or where it is filtered out, and the caller then
+// falls back to pread.
+class ReadAhead::Ring {
+public:
+	Ring(int readFd, unsigned entries);
+	~Ring();
+
+	bool ok() const;
+
+	bool submit(char *buf, size_t size, uint64_t offset, uint64_t tag);
+
+	// waits for one completion, returning its tag and result
+	bool wait(uint64_t &tag, int &result);
+
+private:
+	int fd;
+	bool ready;
+
+	void *sqPtr, *cqPtr;
+	size_t sqSize, cqSize, sqesSize;
+	struct io_uring_sqe *sqes;
+
+	unsigned *sqHead, *sqTail, *sqMask, *sqArray;
+	unsigned *cqHead, *cqTail, *cqMask;
+	struct io_uring_cqe *cqes;
+
+	// iovecs of the reads in flight have to outlive their submission
+	struct iovec *iovecs;
+	unsigned entries;
+	int readFd;
+};
+
+ReadAhead::Ring::Ring(int readFd, unsigned n){
+	this->readFd = readFd;
+	this->ready = false;
+	this->sqPtr = this->cqPtr = MAP_FAILED;
+	this->sqes = (struct io_uring_sqe*)MAP_FAILED;
+	this->iovecs = NULL;
+
+	struct io_uring_params params;
+	memset(&params, 0, sizeof(params));
+	this->fd = syscall(__NR_io_uring_setup, n, &params);
+	if (this->fd < 0)
+		return;
+
+	this->entries = params.sq_entries;
+	this->sqSize = params.sq_off.array + params.sq_entries*sizeof(unsigned);
+	this->cqSize = params.cq_off.cqes + params.cq_entries*sizeof(struct io_uring_cqe);
+	this->sqesSize = params.sq_entries*sizeof(struct io_uring_sqe);
+
+	this->sqPtr = mmap(NULL, this->sqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, this->fd, IORING_OFF_SQ_RING);
+	this->cqPtr = mmap(NULL, this->cqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, this->fd, IORING_OFF_CQ_RING);
+	this->sqes = (struct io_uring_sqe*)mmap(NULL, this->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, this->fd, IORING_OFF_SQES);
+	if (this->sqPtr == MAP_FAILED || this->cqPtr == MAP_FAILED || this->sqes == MAP_FAILED)
+		return;
+
+	char *sq = (char*)this->sqPtr;
+	this->sqHead = (unsigned*)(sq + params.sq_off.head);
+	this->sqTail = (unsigned*)(sq + params.sq_off.tail);
+	this->sqMask = (unsigned*)(sq + params.sq_off.ring_mask);
+	this->sqArray = (unsigned*)(sq + params.sq_off.array);
+
+	char *cq = (char*)this->cqPtr;
+	this->cqHead = (unsigned*)(cq + params.cq_off.head);
+	this->cqTail = (unsigned*)(cq + params.cq_off.tail);
+	this->cqMask = (unsigned*)(cq + params.cq_off.ring_mask);
+	this->cqes = (struct io_uring_cqe*)(cq + params.cq_off.cqes);
+
+	this->iovecs = new struct iovec[this->entries];
+	this->ready = true;
+}
+
+ReadAhead::Ring::~Ring(){
+	if (this->sqes != MAP_FAILED)
+		munmap(this->sqes, this->sqesSize);
+	if (this->cqPtr != MAP_FAILED)
+		munmap(this->cqPtr, this->cqSize);
+	if (this->sqPtr != MAP_FAILED)
+		munmap(this->sqPtr, this->sqSize);
+	if (this->fd >= 0)
+		close(this->fd);
+	delete[] this->iovecs;
+}
+
+bool ReadAhead::Ring::ok() const {
+	return this->ready;
+}
+
+bool ReadAhead::Ring::submit(char *buf, size_t size, uint64_t offset, uint64_t tag){
+	unsigned tail = *this->sqTail;
+	unsigned head = __atomic_load_n(this->sqHead, __ATOMIC_ACQUIRE);
+	if (tail - head >= this->entries)
+		return false;
+
+	unsigned index = tail & *this->sqMask;
+	struct iovec &iov = this->iovecs[index];
+	iov.iov_base = buf;
+	iov.iov_len = size;
+
+	// READV rather than READ, which needs a newer kernel
+	struct io_uring_sqe &sqe = this->sqes[index];
+	memset(&sqe, 0, sizeof(sqe));
+	sqe.opcode = IORING_OP_READV;
+	sqe.fd = this->readFd;
+	sqe.addr = (uint64_t)&iov;
+	sqe.len = 1;
+	sqe.off = offset;
+	sqe.user_data = tag;
+
+	this->sqArray[index] = index;
+	__atomic_store_n(this->sqTail, tail + 1, __ATOMIC_RELEASE);
+
+	int r;
+	do {
+		r = syscall(__NR_io_uring_enter, this->fd, 1, 0, 0, NULL, 0);
+	} while (r < 0 && errno == EINTR);
+	return r == 1;
+}
+
+bool ReadAhead::Ring::wait(uint64_t &tag, int &result){
+	for (;;){
+		unsigned head = *this->cqHead;
+		unsigned tail = __atomic_load_n(this->cqTail, __ATOMIC_ACQUIRE);
+		if (head != tail){
+			struct io_uring_cqe &cqe = this->cqes[head & *this->cqMask];
+			tag = cqe.user_data;
+			result = cqe.res;
+			__atomic_store_n(this->cqHead, head + 1, __ATOMIC_RELEASE);
+			return true;
+		}
+
+		int r = syscall(__NR_io_uring_enter, this->fd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+		if (r < 0 && errno != EINTR)
+			return false;
+	}
+}
+
+#else
+
+// without io_uring headers every read goes through pread
+class ReadAhead::Ring {
+public:
+	Ring(int, unsigned){}
+	bool ok() const {return false;}
+	bool submit(char *, size_t, uint64_t, uint64_t){return false;}
+	bool wait(uint64_t &, int &){return false;}
+};
+
+#endif
+
+// the format limits the sizes of BlobHeaders and blobs, which guards
+// against allocating whatever a corrupt size asks for
+static const uint32_t maxHeaderSize = 64*1024;
+static const int32_t maxBlobSize = 32*1024*1024;
+
+Frame::Frame(){
+	offset = end = 0;
+	done = false;
+}
+
+ReadAhead::ReadAhead(const char *file, uint64_t offset, unsigned depth){
+	this->depth = depth > 0 ? depth : 1;
+	this->start = this->position = offset;
+	this->stop = this->finished = this->error = false;
+	this->ring = NULL;
+
+	this->fd = open(file, O_RDONLY);
+	if (this->fd < 0)
+		return;
+
+	posix_fadvise(this->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+	this->ring = new Ring(this->fd, this->depth);
+	if (!this->ring->ok()){
+		delete this->ring;
+		this->ring = NULL;
+	}
+
+	this->thread = std::thread(&ReadAhead::run, this);
+}
+
+ReadAhead::~ReadAhead(){
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		this->stop = true;
+	}
+	this->consumed.notify_all();
+
+	if (this->thread.joinable())
+		this->thread.join();
+
+	delete this->ring;
+	if (this->fd >= 0)
+		close(this->fd);
+}
+
+bool ReadAhead::ok() const {
+	return this->fd >= 0;
+}
+
+bool ReadAhead::failed() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	return this->error;
+}
+
+uint64_t ReadAhead::offset() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	return this->position;
+}
+
+bool ReadAhead::next(Frame &frame, size_t &queued){
+	std::unique_lock<std::mutex> lock(mutex);
+	queued = this->queue.size();
+	while (this->queue.empty() && !this->finished)
+		this->produced.wait(lock);
+
+	if (this->queue.empty())
+		return false;
+
+	frame.offset = this->queue.front().offset;
+	frame.end = this->queue.front().end;
+	frame.data.swap(this->queue.front().data);
+	this->queue.pop_front();
+	this->position = frame.end;
+
+	this->consumed.notify_one();
+	return true;
+}
+
+void ReadAhead::push(Frame &frame){
+	std::lock_guard<std::mutex> lock(mutex);
+	this->queue.push_back(Frame());
+	this->queue.back().offset = frame.offset;
+	this->queue.back().end = frame.end;
+	this->queue.back().data.swap(frame.data);
+	this->produced.notify_one();
+}
+
+void ReadAhead::finish(bool failed){
+	std::lock_guard<std::mutex> lock(mutex);
+	this->finished = true;
+	this->error = failed;
+	this->produced.notify_one();
+}
+
+// reads the framing of the blob at offset and sizes its data buffer.
+// Returns 1 when there is a blob, 0 at the end of the file and -1 on error.
+int ReadAhead::readHeader(uint64_t offset, Frame &frame){
+	uint32_t headerSize;
+	ssize_t r = preadFully(this->fd, (char*)&headerSize, sizeof(headerSize), offset);
+	if (r == 0)
+		return 0;
+	if (r != sizeof(headerSize))
+		return -1;
+
+	headerSize = ntohl(headerSize);
+	if (headerSize > maxHeaderSize)
+		return -1;
+
+	std::string data(headerSize, '\0');
+	OSMPBF::BlobHeader blobHeader;
+	if (preadFully(this->fd, &data[0], headerSize, offset + sizeof(headerSize)) != (ssize_t)headerSize
+			|| !blobHeader.ParseFromString(data)
+			|| blobHeader.datasize() < 0 || blobHeader.datasize() > maxBlobSize)
+		return -1;
+
+	frame.offset = offset;
+	frame.end = offset + sizeof(headerSize) + headerSize + blobHeader.datasize();
+	frame.data.resize(blobHeader.datasize());
+	frame.done = frame.data.empty();
+
+	posix_fadvise(this->fd, frame.end - frame.data.size(), frame.data.size(), POSIX_FADV_WILLNEED);
+	return 1;
+}
+
+void ReadAhead::run(){
+
+	// blobs submitted to the ring, in file order; they are only queued for
+	// the reader once every blob before them is complete too
+	std::deque<Frame*> inflight;
+	size_t submitted = 0;
+	uint64_t offset = this->start;
+	bool eof = false, failed = false;
+
+	while (!failed){
+
+		// start reading blobs while there is room for them
+		while (!eof){
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				while (!this->stop && inflight.empty() && this->queue.size() >= this->depth)
+					this->consumed.wait(lock);
+				if (this->stop || this->queue.size() + inflight.size() >= this->depth)
+					break;
+			}
+
+			Frame *frame = new Frame;
+			int r = this->readHeader(offset, *frame);
+			if (r <= 0){
+				delete frame;
+				eof = r == 0;
+				failed = r < 0;
+				break;
+			}
+			offset = frame->end;
+
+			size_t size = frame->data.size();
+			uint64_t dataOffset = frame->end - size;
+			if (this->ring){
+				inflight.push_back(frame);
+				if (size > 0){
+					if (!this->ring->submit(&frame->data[0], size, dataOffset, (uint64_t)frame)){
+						inflight.pop_back();
+						delete frame;
+						failed = true;
+						break;
+					}
+					submitted++;
+				}
+			} else {
+				if (preadFully(this->fd, &frame->data[0], size, dataOffset) != (ssize_t)size)
+					failed = true;
+				else
+					this->push(*frame);
+				delete frame;
+				if (failed)
+					break;
+			}
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (this->stop)
+				break;
+		}
+
+		// empty blobs are complete without a read, and may be all there is
+		while (!failed && !inflight.empty() && inflight.front()->done){
+			this->push(*inflight.front());
+			delete inflight.front();
+			inflight.pop_front();
+		}
+
+		if (failed || submitted == 0){
+			if (eof || failed)
+				break;
+			continue;
+		}
+
+		// wait for a read to complete, finishing short reads by hand
+		uint64_t tag;
+		int result;
+		if (!this->ring->wait(tag, result)){
+			failed = true;
+			break;
+		}
+		submitted--;
+
+		Frame *frame = (Frame*)tag;
+		size_t size = frame->data.size();
+		uint64_t dataOffset = frame->end - size;
+		if (result < 0)
+			failed = true;
+		else if ((size_t)result < size && preadFully(this->fd, &frame->data[result], size - result, dataOffset + result) != (ssize_t)(size - result))
+			failed = true;
+		frame->done = true;
+
+		while (!failed && !inflight.empty() && inflight.front()->done){
+			this->push(*inflight.front());
+			delete inflight.front();
+			inflight.pop_front();
+		}
+	}
+
+	// the kernel may still be writing into the buffers of reads in flight
+	for (; submitted > 0; submitted--){
+		uint64_t tag;
+		int result;
+		if (!this->ring->wait(tag, result))
+			break;
+	}
+	for (size_t n = 0; n < inflight.size(); n++)
+		delete inflight[n];
+
+	this->finish(failed);
+}
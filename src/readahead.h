@@ -0,0 +1,66 @@
+#ifndef LIBOSMPBF_READAHEAD_H
+#define LIBOSMPBF_READAHEAD_H
+
+#include <string>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <stdint.h>
+
+namespace libosmpbf {
+
+// a blob read ahead of being needed: its data, and where it starts and
+// ends in the file
+struct Frame {
+	Frame();
+	uint64_t offset, end;
+	std::string data;
+	bool done;
+};
+
+// Reads the blobs of a file on a thread of its own, keeping up to depth of
+// them read or being read ahead of the one being decoded. The data of
+// several blobs is read at once through io_uring where the kernel allows
+// it, and otherwise one at a time with pread; either way posix_fadvise
+// tells the kernel what is coming.
+class ReadAhead {
+public:
+	ReadAhead(const char *file, uint64_t offset, unsigned depth);
+	~ReadAhead();
+
+	bool ok() const;
+
+	// the next blob in file order; false at the end of the file or, if
+	// failed() says so, on an error. queued is how many blobs were ready
+	// when it was asked for, so 0 when it had to wait.
+	bool next(Frame &frame, size_t &queued);
+
+	bool failed() const;
+
+	// where the blob next() returns starts
+	uint64_t offset() const;
+
+private:
+	class Ring;
+
+	void run();
+	int readHeader(uint64_t offset, Frame &frame);
+	void push(Frame &frame);
+	void finish(bool failed);
+
+	int fd;
+	unsigned depth;
+	uint64_t start, position;
+	Ring *ring;
+
+	std::thread thread;
+	mutable std::mutex mutex;
+	std::condition_variable produced, consumed;
+	std::deque<Frame> queue;
+	bool stop, finished, error;
+};
+
+} // end namespace
+
+#endif
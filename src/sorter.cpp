@@ -0,0 +1,324 @@
+#include <stdlib.h>
+#include <unistd.h>
+#include <algorithm>
+#include <queue>
+#include <thread>
+
+#include "protobuf/osm.pb.h"
+#include "libosmpbf.h"
+using namespace libosmpbf;
+
+// what one cursor of a merge is expected to hold: a decoded block, its blob
+// and the views of its objects. Cursors do not read ahead, so that is all;
+// each holds one descriptor and no thread.
+static const size_t cursorBytes = 8*1024*1024;
+
+// the objects of the held blocks, as apply() walks them, and the blocks
+// themselves, which the objects refer to
+struct PbfSorter::Objects {
+	std::vector<PbfBlock> blocks;
+	std::vector<BlockNode> nodes;
+	std::vector<BlockWay> ways;
+	std::vector<BlockRelation> relations;
+	size_t blockBytes;
+
+	Objects() : blockBytes(0){}
+
+	void node(const BlockNode &node){nodes.push_back(node);}
+	void way(const BlockWay &way){ways.push_back(way);}
+	void relation(const BlockRelation &relation){relations.push_back(relation);}
+
+	size_t bytes() const {
+		return blockBytes + nodes.capacity()*sizeof(BlockNode) + ways.capacity()*sizeof(BlockWay)
+			+ relations.capacity()*sizeof(BlockRelation);
+	}
+
+	void clear(){
+		blocks.clear();
+		std::vector<BlockNode>().swap(nodes);
+		std::vector<BlockWay>().swap(ways);
+		std::vector<BlockRelation>().swap(relations);
+		blockBytes = 0;
+	}
+};
+
+// the objects of one type of a block, as apply() walks them
+template <typename View>
+struct TypeObjects;
+
+template <>
+struct TypeObjects<BlockNode> {
+	void node(const BlockNode &node){views.push_back(node);}
+	std::vector<BlockNode> views;
+};
+
+template <>
+struct TypeObjects<BlockWay> {
+	void way(const BlockWay &way){views.push_back(way);}
+	std::vector<BlockWay> views;
+};
+
+template <>
+struct TypeObjects<BlockRelation> {
+	void relation(const BlockRelation &relation){views.push_back(relation);}
+	std::vector<BlockRelation> views;
+};
+
+// adds objects to builder, writing out each block as it fills up
+template <typename T>
+static void add(BlockBuilder &builder, OPbfStream &out, const T &object){
+	builder.add(object);
+	if (builder.full()){
+		PbfBlock block;
+		builder.build(block);
+		out << block;
+	}
+}
+
+static bool finish(BlockBuilder &builder, OPbfStream &out){
+	if (builder.objects() > 0){
+		PbfBlock block;
+		builder.build(block);
+		out << block;
+	}
+	out.flush();
+	return !out.fail();
+}
+
+// a new empty file in dir, "" when one cannot be made
+static std::string tempFile(const std::string &dir){
+	std::string name = dir + "/libosmpbf-sort-XXXXXX";
+	std::vector<char> path(name.begin(), name.end());
+	path.push_back('\0');
+
+	int fd = mkstemp(&path[0]);
+	if (fd < 0)
+		return "";
+	close(fd);
+	return &path[0];
+}
+
+// writes views to file in id order
+template <typename View>
+static bool writeSorted(const std::vector<View> &views, const std::string &file){
+	std::vector<std::pair<uint64_t, uint32_t> > order(views.size());
+	for (size_t i = 0; i < views.size(); i++)
+		order[i] = std::make_pair(views[i].id(), (uint32_t)i);
+	std::sort(order.begin(), order.end());
+
+	OPbfStream out(file.c_str(), true);
+	BlockBuilder builder;
+	for (size_t i = 0; i < order.size(); i++)
+		add(builder, out, views[order[i].second].clone());
+	return finish(builder, out);
+}
+
+// reads the objects of one type from a run, in order
+template <typename View>
+struct RunCursor {
+	RunCursor(const std::string &file) : stream(file.c_str()), pos(0){
+		stream.setReadAhead(0);
+	}
+
+	// moves to the next object, false at the end of the run
+	bool next(){
+		if (++pos < objects.views.size())
+			return true;
+
+		objects.views.clear();
+		while (stream >> block){
+			apply(block, objects);
+			pos = 0;
+			if (!objects.views.empty())
+				return true;
+		}
+		return false;
+	}
+
+	const View &current() const {return objects.views[pos];}
+
+	PbfStream stream;
+	PbfBlock block;
+	TypeObjects<View> objects;
+	size_t pos;
+};
+
+// merges sorted runs of one type into output, earlier runs first among
+// objects with the same id
+template <typename View>
+static bool mergeRuns(const std::vector<std::string> &files, const std::string &output){
+	typedef std::pair<uint64_t, size_t> Head;
+	std::priority_queue<Head, std::vector<Head>, std::greater<Head> > heads;
+
+	std::vector<std::unique_ptr<RunCursor<View> > > cursors;
+	for (size_t f = 0; f < files.size(); f++){
+		cursors.push_back(std::unique_ptr<RunCursor<View> >(new RunCursor<View>(files[f])));
+		if (cursors[f]->next())
+			heads.push(Head(cursors[f]->current().id(), f));
+	}
+
+	OPbfStream out(output.c_str(), true);
+	BlockBuilder builder;
+	while (!heads.empty()){
+		size_t f = heads.top().second;
+		heads.pop();
+		add(builder, out, cursors[f]->current().clone());
+		if (cursors[f]->next())
+			heads.push(Head(cursors[f]->current().id(), f));
+	}
+
+	for (size_t f = 0; f < cursors.size(); f++){
+		if (cursors[f]->stream.bad())
+			return false;
+	}
+	return finish(builder, out);
+}
+
+PbfSorter::PbfSorter(size_t maxBytes, const char *tempDir){
+	this->maxBytes = maxBytes;
+	this->tempDir = tempDir;
+	this->runCount = 0;
+}
+
+size_t PbfSorter::runs() const {
+	return this->runCount;
+}
+
+void PbfSorter::removeFiles(){
+	for (int t = 0; t < 3; t++){
+		for (size_t f = 0; f < this->files[t].size(); f++)
+			unlink(this->files[t][f].c_str());
+		this->files[t].clear();
+	}
+}
+
+// sorts the held objects and writes a run of each type, the three at once
+bool PbfSorter::writeRun(Objects &objects){
+	std::string names[3];
+	for (int t = 0; t < 3; t++){
+		names[t] = tempFile(this->tempDir);
+		if (names[t].empty())
+			return false;
+		this->files[t].push_back(names[t]);
+	}
+
+	bool ok[3];
+	std::thread ways([&](){ok[Member_Way] = writeSorted(objects.ways, names[Member_Way]);});
+	std::thread relations([&](){ok[Member_Relation] = writeSorted(objects.relations, names[Member_Relation]);});
+	ok[Member_Node] = writeSorted(objects.nodes, names[Member_Node]);
+	ways.join();
+	relations.join();
+
+	this->runCount++;
+	objects.clear();
+	return ok[0] && ok[1] && ok[2];
+}
+
+// merges runs of one type until there are few enough to merge into output
+template <typename View>
+static bool mergeType(std::vector<std::string> &files, size_t fanIn, const std::string &output, const std::string &tempDir){
+	while (files.size() > fanIn){
+		std::vector<std::string> merged;
+		for (size_t f = 0; f < files.size(); f += fanIn){
+			std::vector<std::string> group(files.begin() + f, files.begin() + std::min(f + fanIn, files.size()));
+			if (group.size() == 1){
+				merged.push_back(group[0]);
+				continue;
+			}
+
+			std::string file = tempFile(tempDir);
+			if (file.empty())
+				return false;
+			merged.push_back(file);
+			bool ok = mergeRuns<View>(group, file);
+			for (size_t g = 0; g < group.size(); g++)
+				unlink(group[g].c_str());
+			if (!ok){
+				// the runs not merged yet are still removed by the sorter
+				merged.insert(merged.end(), files.begin() + std::min(f + fanIn, files.size()), files.end());
+				files.swap(merged);
+				return false;
+			}
+		}
+		files.swap(merged);
+	}
+	return mergeRuns<View>(files, output);
+}
+
+// merges the runs of each type into a part of its own, the three at once,
+// and joins the parts into output
+bool PbfSorter::merge(const char *output){
+
+	// the memory bound is shared between the three merges
+	size_t fanIn = std::max((size_t)2, this->maxBytes/3/cursorBytes);
+
+	std::string parts[3];
+	for (int t = 0; t < 3; t++){
+		parts[t] = tempFile(this->tempDir);
+		if (parts[t].empty())
+			return false;
+	}
+
+	bool ok[3];
+	std::thread ways([&](){ok[Member_Way] = mergeType<BlockWay>(this->files[Member_Way], fanIn, parts[Member_Way], this->tempDir);});
+	std::thread relations([&](){ok[Member_Relation] = mergeType<BlockRelation>(this->files[Member_Relation], fanIn, parts[Member_Relation], this->tempDir);});
+	ok[Member_Node] = mergeType<BlockNode>(this->files[Member_Node], fanIn, parts[Member_Node], this->tempDir);
+	ways.join();
+	relations.join();
+
+	bool joined = ok[0] && ok[1] && ok[2];
+	if (joined){
+		OPbfStream out(output, true);
+		for (int t = 0; t < 3 && out; t++){
+			// everything after the part's own header is copied as it is
+			std::streampos start;
+			{
+				PbfStream part(parts[t].c_str());
+				start = part.tellg();
+			}
+			std::ifstream in(parts[t].c_str(), std::ios_base::binary);
+			in.seekg(start);
+			if (in.peek() != std::ifstream::traits_type::eof())
+				(std::ostream&)out << in.rdbuf();
+		}
+		out.flush();
+		joined = !out.fail();
+	}
+
+	for (int t = 0; t < 3; t++)
+		unlink(parts[t].c_str());
+	return joined;
+}
+
+bool PbfSorter::sort(const char *input, const char *output){
+	this->runCount = 0;
+	this->removeFiles();
+
+	// the input is read once from front to back
+	PbfStream in(input);
+	if (!in)
+		return false;
+	in.setReadAhead(4);
+
+	Objects objects;
+	PbfBlock block;
+	bool ok = true;
+	while (ok && in >> block){
+		objects.blocks.push_back(block);
+		objects.blockBytes += block.block->SpaceUsedLong();
+		apply(block, objects);
+
+		if (objects.bytes() >= this->maxBytes)
+			ok = writeRun(objects);
+	}
+
+	if (ok && in.bad())
+		ok = false;
+	if (ok && (this->runCount == 0 || !objects.blocks.empty()))
+		ok = writeRun(objects);
+	if (ok)
+		ok = merge(output);
+
+	this->removeFiles();
+	return ok;
+}
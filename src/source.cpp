@@ -0,0 +1,160 @@
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+
+#include "source.h"
+using namespace libosmpbf;
+
+FdSource::FdSource(int fd){
+	this->fd = fd;
+
+	off_t start = lseek(fd, 0, SEEK_CUR);
+	this->seekable = start >= 0;
+	this->position = this->seekable ? start : 0;
+
+	this->setg(this->buffer, this->buffer, this->buffer);
+}
+
+ssize_t FdSource::readSome(char *buf, size_t size){
+	ssize_t r;
+	do {
+		r = read(this->fd, buf, size);
+	} while (r < 0 && errno == EINTR);
+
+	if (r > 0)
+		this->position += r;
+	return r;
+}
+
+FdSource::int_type FdSource::underflow(){
+	if (this->gptr() < this->egptr())
+		return traits_type::to_int_type(*this->gptr());
+
+	ssize_t r = readSome(this->buffer, bufferSize);
+	if (r <= 0)
+		return traits_type::eof();
+
+	this->setg(this->buffer, this->buffer, this->buffer + r);
+	return traits_type::to_int_type(*this->gptr());
+}
+
+std::streamsize FdSource::xsgetn(char *s, std::streamsize n){
+	std::streamsize done = 0;
+
+	// whatever is buffered first, then directly into s
+	std::streamsize buffered = this->egptr() - this->gptr();
+	if (buffered > 0){
+		done = buffered < n ? buffered : n;
+		memcpy(s, this->gptr(), done);
+		this->gbump(done);
+	}
+
+	// short requests refill the buffer instead, so that a blob's framing
+	// does not cost a read each
+	if (n - done < (std::streamsize)bufferSize){
+		while (done < n && this->underflow() != traits_type::eof()){
+			std::streamsize chunk = this->egptr() - this->gptr();
+			if (chunk > n - done)
+				chunk = n - done;
+			memcpy(s + done, this->gptr(), chunk);
+			this->gbump(chunk);
+			done += chunk;
+		}
+		return done;
+	}
+
+	while (done < n){
+		ssize_t r = readSome(s + done, n - done);
+		if (r <= 0)
+			break;
+		done += r;
+	}
+	return done;
+}
+
+FdSource::pos_type FdSource::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which){
+	uint64_t current = this->position - (this->egptr() - this->gptr());
+	if (dir == std::ios_base::cur)
+		return this->seekpos(current + off, which);
+	if (dir == std::ios_base::beg)
+		return this->seekpos(off, which);
+
+	if (!this->seekable)
+		return pos_type(off_type(-1));
+	off_t end = lseek(this->fd, 0, SEEK_END);
+	if (end < 0)
+		return pos_type(off_type(-1));
+	this->position = end;
+	this->setg(this->buffer, this->buffer, this->buffer);
+	return this->seekpos(end + off, which);
+}
+
+FdSource::pos_type FdSource::seekpos(pos_type pos, std::ios_base::openmode which){
+	if (!(which & std::ios_base::in) || off_type(pos) < 0)
+		return pos_type(off_type(-1));
+
+	uint64_t target = off_type(pos);
+	uint64_t start = this->position - (this->egptr() - this->eback());
+
+	// within the buffer
+	if (target >= start && target <= this->position){
+		this->setg(this->eback(), this->eback() + (target - start), this->egptr());
+		return pos;
+	}
+
+	if (this->seekable){
+		if (lseek(this->fd, target, SEEK_SET) < 0)
+			return pos_type(off_type(-1));
+		this->position = target;
+		this->setg(this->buffer, this->buffer, this->buffer);
+		return pos;
+	}
+
+	// a pipe can only be skipped through
+	if (target < this->position)
+		return pos_type(off_type(-1));
+
+	this->setg(this->buffer, this->buffer, this->buffer);
+	while (this->position < target){
+		uint64_t left = target - this->position;
+		ssize_t r = readSome(this->buffer, left < bufferSize ? left : bufferSize);
+		if (r <= 0)
+			return pos_type(off_type(-1));
+	}
+	return pos;
+}
+
+SpanSource::SpanSource(const char *data, size_t size){
+	// the get area is only ever read from
+	char *begin = const_cast<char*>(data);
+	this->setg(begin, begin, begin + size);
+}
+
+const char *SpanSource::current() const {
+	return this->gptr();
+}
+
+size_t SpanSource::available() const {
+	return this->egptr() - this->gptr();
+}
+
+void SpanSource::advance(size_t n){
+	this->setg(this->eback(), this->gptr() + n, this->egptr());
+}
+
+SpanSource::pos_type SpanSource::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which){
+	off_type base = 0;
+	if (dir == std::ios_base::cur)
+		base = this->gptr() - this->eback();
+	else if (dir == std::ios_base::end)
+		base = this->egptr() - this->eback();
+	return this->seekpos(base + off, which);
+}
+
+SpanSource::pos_type SpanSource::seekpos(pos_type pos, std::ios_base::openmode which){
+	off_type target = pos;
+	if (!(which & std::ios_base::in) || target < 0 || target > this->egptr() - this->eback())
+		return pos_type(off_type(-1));
+	this->setg(this->eback(), this->eback() + target, this->egptr());
+	return pos;
+}
@@ -0,0 +1,53 @@
+#ifndef LIBOSMPBF_SOURCE_H
+#define LIBOSMPBF_SOURCE_H
+
+#include <streambuf>
+#include <stdint.h>
+
+namespace libosmpbf {
+
+// Reads a file descriptor, which may be a pipe or stdin. Only a little is
+// buffered, enough for the framing of a blob; larger reads go straight
+// into the caller's buffer. Seeking forward works on anything, by reading
+// and discarding, but seeking back needs a descriptor that can be seeked.
+class FdSource : public std::streambuf {
+public:
+	FdSource(int fd);
+
+protected:
+	int_type underflow();
+	std::streamsize xsgetn(char *s, std::streamsize n);
+	pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which);
+	pos_type seekpos(pos_type pos, std::ios_base::openmode which);
+
+private:
+	ssize_t readSome(char *buf, size_t size);
+
+	static const size_t bufferSize = 4096;
+
+	int fd;
+	bool seekable;
+
+	// offset in the file of the end of what has been read into buffer
+	uint64_t position;
+	char buffer[bufferSize];
+};
+
+// Reads a span of memory that the caller keeps alive. PbfStream inflates
+// blobs where they lie through current() rather than reading them out.
+class SpanSource : public std::streambuf {
+public:
+	SpanSource(const char *data, size_t size);
+
+	const char *current() const;
+	size_t available() const;
+	void advance(size_t n);
+
+protected:
+	pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which);
+	pos_type seekpos(pos_type pos, std::ios_base::openmode which);
+};
+
+} // end namespace
+
+#endif
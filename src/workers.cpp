@@ -0,0 +1,88 @@
+#include "workers.h"
+using namespace libosmpbf;
+
+WorkerPool::WorkerPool(unsigned threads){
+	if (threads == 0)
+		threads = std::thread::hardware_concurrency();
+
+	this->task = NULL;
+	this->count = 0;
+	this->next = 0;
+	this->busy = 0;
+	this->generation = 0;
+	this->stop = false;
+
+	for (unsigned t = 1; t < threads; t++)
+		this->threads.push_back(std::thread(&WorkerPool::work, this, t));
+}
+
+WorkerPool::~WorkerPool(){
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		this->stop = true;
+	}
+	this->started.notify_all();
+
+	for (size_t t = 0; t < this->threads.size(); t++)
+		this->threads[t].join();
+}
+
+unsigned WorkerPool::size() const {
+	return this->threads.size() + 1;
+}
+
+void WorkerPool::run(size_t count, const std::function<void(size_t, unsigned)> &task){
+	if (count == 0)
+		return;
+
+	// with a single item there is nothing to share out
+	if (this->threads.empty() || count == 1){
+		for (size_t n = 0; n < count; n++)
+			task(n, 0);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		this->task = &task;
+		this->count = count;
+		this->next = 0;
+		this->busy = this->threads.size();
+		this->generation++;
+	}
+	this->started.notify_all();
+
+	take(0);
+
+	// every thread has to be done with the task before it goes out of scope
+	std::unique_lock<std::mutex> lock(mutex);
+	while (this->busy > 0)
+		this->finished.wait(lock);
+	this->task = NULL;
+}
+
+void WorkerPool::work(unsigned worker){
+	uint64_t done = 0;
+	for (;;){
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			while (this->generation == done && !this->stop)
+				this->started.wait(lock);
+			if (this->stop)
+				return;
+			done = this->generation;
+		}
+
+		take(worker);
+
+		std::lock_guard<std::mutex> lock(mutex);
+		if (--this->busy == 0)
+			this->finished.notify_one();
+	}
+}
+
+// runs items of the current task until there are none left
+void WorkerPool::take(unsigned worker){
+	for (size_t n = this->next++; n < this->count; n = this->next++)
+		(*this->task)(n, worker);
+}
@@ -0,0 +1,53 @@
+#ifndef LIBOSMPBF_WORKERS_H
+#define LIBOSMPBF_WORKERS_H
+
+#include <vector>
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <stdint.h>
+
+namespace libosmpbf {
+
+// Threads that are started once and then share out the items of one task
+// after another, so work done a block at a time does not pay for starting
+// and joining threads on every block. The thread calling run() takes items
+// too, so a pool of one thread starts none of its own.
+class WorkerPool {
+public:
+	// threads counts the caller; 0 uses one per core
+	WorkerPool(unsigned threads);
+	~WorkerPool();
+
+	unsigned size() const;
+
+	// calls task(item, worker) for every item below count, and returns once
+	// all of them are done. worker is below size(), and no two calls at
+	// once share one, so it can pick out buffers of that thread's own.
+	// Items are handed out one at a time as threads come free.
+	void run(size_t count, const std::function<void(size_t, unsigned)> &task);
+
+private:
+	void work(unsigned worker);
+	void take(unsigned worker);
+
+	std::vector<std::thread> threads;
+	std::mutex mutex;
+	std::condition_variable started, finished;
+
+	// the task being run, and the number of threads still working on it
+	const std::function<void(size_t, unsigned)> *task;
+	size_t count;
+	std::atomic<size_t> next;
+	unsigned busy;
+
+	// counts tasks, so a thread can tell a new one from the last it did
+	uint64_t generation;
+	bool stop;
+};
+
+} // end namespace
+
+#endif
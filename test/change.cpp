@@ -0,0 +1,209 @@
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "libosmpbf.h"
+#include "test.h"
+
+// Checks that ChangeStream applies an OsmChange with creates, modifies and
+// deletes of every type to a small sorted file, keeping the output sorted
+// and carrying tags and metadata through, including for objects created
+// past the last block of their type.
+
+using namespace libosmpbf;
+
+static const char *file = "change.pbf";
+static const char *osc = "change.osc";
+
+static Info info(int32_t version, int64_t timestamp, int64_t changeset, int32_t uid, const std::string &user){
+	Info i;
+	i.version = version;
+	i.timestamp = timestamp;
+	i.changeset = changeset;
+	i.uid = uid;
+	i.user = user;
+	return i;
+}
+
+static bool sameInfo(const Info &a, const Info &b){
+	return a.version == b.version && a.timestamp == b.timestamp && a.changeset == b.changeset
+		&& a.uid == b.uid && a.user == b.user;
+}
+
+static Node node(uint64_t id, double lat, double lon){
+	Node n;
+	n.id = id;
+	n.coords.lat = lat;
+	n.coords.lon = lon;
+	n.info = info(1, 1000000000 + id, 100 + id, 7, "original");
+	return n;
+}
+
+// nodes 1 to 6 and 10 to 12 in two blocks, ways 100 and 101, relation 200
+static void writeFile(){
+	OPbfStream out(file, true);
+	BlockBuilder builder;
+	PbfBlock block;
+
+	for (uint64_t id = 1; id <= 6; id++){
+		Node n = node(id, 50 + id * 0.001, 8 + id * 0.001);
+		if (id % 2 == 0)
+			n.tags["name"] = "node " + std::to_string(id);
+		builder.add(n);
+	}
+	builder.build(block);
+	out << block;
+
+	for (uint64_t id = 10; id <= 12; id++)
+		builder.add(node(id, 50 + id * 0.001, 8 + id * 0.001));
+	builder.build(block);
+	out << block;
+
+	for (uint64_t id = 100; id <= 101; id++){
+		Way way;
+		way.id = id;
+		way.nodeIds = {1, 2, 3};
+		way.tags["highway"] = "path";
+		way.info = info(2, 1100000000, 300, 8, "original");
+		builder.add(way);
+	}
+	builder.build(block);
+	out << block;
+
+	Relation relation;
+	relation.id = 200;
+	relation.members.push_back(Relation::Member(100, Member_Way, "outer"));
+	relation.tags["type"] = "multipolygon";
+	builder.add(relation);
+	builder.build(block);
+	out << block;
+}
+
+static void writeChanges(){
+	std::ofstream out(osc);
+	out << "<?xml version='1.0' encoding='UTF-8'?>\n"
+		"<osmChange version=\"0.6\">\n"
+		"<modify>\n"
+		" <node id=\"2\" version=\"2\" timestamp=\"2020-01-02T03:04:05Z\" changeset=\"900\" uid=\"42\" user=\"editor\" lat=\"51.5\" lon=\"-0.1\">\n"
+		"  <tag k=\"name\" v=\"renamed\"/>\n"
+		"  <tag k=\"amenity\" v=\"cafe\"/>\n"
+		" </node>\n"
+		" <relation id=\"200\" version=\"3\" timestamp=\"2020-01-02T03:04:05Z\" changeset=\"901\" uid=\"42\" user=\"editor\">\n"
+		"  <member type=\"way\" ref=\"101\" role=\"inner\"/>\n"
+		"  <member type=\"node\" ref=\"7\" role=\"\"/>\n"
+		"  <tag k=\"type\" v=\"site\"/>\n"
+		" </relation>\n"
+		"</modify>\n"
+		"<delete>\n"
+		" <node id=\"4\" version=\"2\"/>\n"
+		" <way id=\"100\" version=\"3\"/>\n"
+		"</delete>\n"
+		"<create>\n"
+		" <node id=\"7\" version=\"1\" timestamp=\"2020-01-02T03:04:05Z\" changeset=\"902\" uid=\"43\" user=\"mapper\" lat=\"1\" lon=\"2\"/>\n"
+		" <node id=\"50\" version=\"1\" timestamp=\"2020-01-02T03:04:05Z\" changeset=\"902\" uid=\"43\" user=\"mapper\" lat=\"-33.5\" lon=\"151.25\">\n"
+		"  <tag k=\"natural\" v=\"tree\"/>\n"
+		" </node>\n"
+		" <way id=\"102\" version=\"1\" timestamp=\"2020-01-02T03:04:05Z\" changeset=\"902\" uid=\"43\" user=\"mapper\">\n"
+		"  <nd ref=\"7\"/>\n"
+		"  <nd ref=\"50\"/>\n"
+		"  <tag k=\"highway\" v=\"track\"/>\n"
+		" </way>\n"
+		" <relation id=\"300\" version=\"1\" timestamp=\"2020-01-02T03:04:05Z\" changeset=\"902\" uid=\"43\" user=\"mapper\">\n"
+		"  <member type=\"way\" ref=\"102\" role=\"\"/>\n"
+		"  <tag k=\"type\" v=\"route\"/>\n"
+		" </relation>\n"
+		"</create>\n"
+		"</osmChange>\n";
+}
+
+template <typename T>
+static std::vector<uint64_t> ids(const std::vector<T> &objects){
+	std::vector<uint64_t> v;
+	for (size_t n = 0; n < objects.size(); n++)
+		v.push_back(objects[n].id);
+	return v;
+}
+
+int main(){
+	writeFile();
+	writeChanges();
+
+	OsmChange changes;
+	check(changes.load(osc), "change file loads");
+	check(changes.size() == 8, "change file holds 8 changes");
+
+	// read the changed file back, noting the order the types come in
+	std::vector<Node> nodes;
+	std::vector<Way> ways;
+	std::vector<Relation> relations;
+	std::vector<int> types;
+	{
+		PbfStream in(file);
+		ChangeStream stream(in, changes);
+		PbfBlock block;
+		while (stream >> block){
+			for (PbfBlock::NodeIterator i = block.nodesBegin(); i != block.nodesEnd(); i.next()){
+				nodes.push_back((*i).clone());
+				types.push_back(Member_Node);
+			}
+			for (PbfBlock::WayIterator i = block.waysBegin(); i != block.waysEnd(); i.next()){
+				ways.push_back((*i).clone());
+				types.push_back(Member_Way);
+			}
+			for (PbfBlock::RelationIterator i = block.relationsBegin(); i != block.relationsEnd(); i.next()){
+				relations.push_back((*i).clone());
+				types.push_back(Member_Relation);
+			}
+		}
+		check(!in.bad(), "input read");
+	}
+	remove(file);
+	remove(osc);
+
+	// sorted by type then id, with deletes gone and creates in place
+	check(std::is_sorted(types.begin(), types.end()), "types in order");
+	check(ids(nodes) == std::vector<uint64_t>({1, 2, 3, 5, 6, 7, 10, 11, 12, 50}), "node ids");
+	check(ids(ways) == std::vector<uint64_t>({101, 102}), "way ids");
+	check(ids(relations) == std::vector<uint64_t>({200, 300}), "relation ids");
+	if (failures > 0)
+		return result("change");
+
+	const int64_t changed = 1577934245; // 2020-01-02T03:04:05Z
+
+	// copied objects keep their tags and metadata
+	check(nodes[0].tags.empty() && sameInfo(nodes[0].info, info(1, 1000000001, 101, 7, "original")), "node 1 copied");
+	check(nodes[3].tags.size() == 0 && sameInfo(nodes[3].info, info(1, 1000000005, 105, 7, "original")), "node 5 copied");
+	check(nodes[4].tags.size() == 1 && nodes[4].tags["name"] == "node 6", "node 6 tags copied");
+	check(std::fabs(nodes[7].coords.lat - 50.011) < 1e-7 && std::fabs(nodes[7].coords.lon - 8.011) < 1e-7, "node 11 coords copied");
+	check(ways[0].tags["highway"] == "path" && ways[0].nodeIds.size() == 3
+		&& sameInfo(ways[0].info, info(2, 1100000000, 300, 8, "original")), "way 101 copied");
+
+	// a modify replaces tags, coords and metadata
+	Node &modified = nodes[1];
+	check(modified.tags.size() == 2 && modified.tags["name"] == "renamed" && modified.tags["amenity"] == "cafe", "node 2 tags");
+	check(std::fabs(modified.coords.lat - 51.5) < 1e-7 && std::fabs(modified.coords.lon + 0.1) < 1e-7, "node 2 coords");
+	check(sameInfo(modified.info, info(2, changed, 900, 42, "editor")), "node 2 metadata");
+
+	Relation &relation = relations[0];
+	check(relation.tags.size() == 1 && relation.tags["type"] == "site", "relation 200 tags");
+	check(relation.members.size() == 2 && relation.members.front().id == 101
+		&& relation.members.front().type == Member_Way && relation.members.front().role == "inner"
+		&& relation.members.back().id == 7 && relation.members.back().type == Member_Node, "relation 200 members");
+	check(sameInfo(relation.info, info(3, changed, 901, 42, "editor")), "relation 200 metadata");
+
+	// a create between two blocks, and creates past the last block of
+	// each type
+	check(nodes[5].tags.empty() && sameInfo(nodes[5].info, info(1, changed, 902, 43, "mapper")), "node 7 created");
+	Node &last = nodes[9];
+	check(last.tags.size() == 1 && last.tags["natural"] == "tree", "node 50 tags");
+	check(std::fabs(last.coords.lat + 33.5) < 1e-7 && std::fabs(last.coords.lon - 151.25) < 1e-7, "node 50 coords");
+	check(sameInfo(last.info, info(1, changed, 902, 43, "mapper")), "node 50 metadata");
+	check(ways[1].nodeIds == std::list<uint64_t>({7, 50}) && ways[1].tags["highway"] == "track"
+		&& sameInfo(ways[1].info, info(1, changed, 902, 43, "mapper")), "way 102 created");
+	check(relations[1].members.size() == 1 && relations[1].members.front().id == 102
+		&& relations[1].tags["type"] == "route" && sameInfo(relations[1].info, info(1, changed, 902, 43, "mapper")), "relation 300 created");
+
+	return result("change");
+}
@@ -0,0 +1,113 @@
+#include <iostream>
+#include <vector>
+
+#include "libosmpbf.h"
+#include "test.h"
+
+// Checks that every way of reading a node's coordinates applies a block's
+// granularity and lat/lon offsets the same way, as the format defines them:
+// (offset + granularity*value) nanodegrees.
+
+using namespace libosmpbf;
+
+static const char *file = "coordinates.pbf";
+static const char *sidecar = "coordinates.pbf.cols";
+
+static const int32_t granularity = 1000;
+static const int64_t latOffset = 500000000, lonOffset = -250000000;
+
+// stored values of each node, dense ones first
+static const int64_t lats[] = {1000, 1500, -2000, 7, 300000};
+static const int64_t lons[] = {-4000, 0, 123456, 9, -300000};
+static const int denseNodes = 3, nodes = 5;
+
+static double expected(int64_t offset, int64_t value){
+	return (offset + granularity*value)/1000000000.0;
+}
+
+struct Locations {
+	void node(const BlockNode &node){coords.push_back(node.coords());}
+	std::vector<Coords> coords;
+};
+
+static void checkCoords(const std::string &name, size_t n, double lat, double lon){
+	std::string where = name + ", node " + std::to_string(n);
+	check(n < (size_t)nodes, where + " is not expected");
+	if (n < (size_t)nodes){
+		check(lat == expected(latOffset, lats[n]), where + ", lat");
+		check(lon == expected(lonOffset, lons[n]), where + ", lon");
+	}
+}
+
+int main(){
+
+	// dense nodes, delta coded, then plain nodes in a group of their own
+	{
+		OPbfStream out(file);
+		OSMPBF::PrimitiveBlock block;
+		block.mutable_stringtable()->add_s("");
+		block.set_granularity(granularity);
+		block.set_lat_offset(latOffset);
+		block.set_lon_offset(lonOffset);
+
+		OSMPBF::DenseNodes &dense = *block.add_primitivegroup()->mutable_dense();
+		for (int n = 0; n < denseNodes; n++){
+			dense.add_id(1);
+			dense.add_lat(lats[n] - (n > 0 ? lats[n-1] : 0));
+			dense.add_lon(lons[n] - (n > 0 ? lons[n-1] : 0));
+		}
+
+		OSMPBF::PrimitiveGroup &group = *block.add_primitivegroup();
+		for (int n = denseNodes; n < nodes; n++){
+			OSMPBF::Node &node = *group.add_nodes();
+			node.set_id(n + 1);
+			node.set_lat(lats[n]);
+			node.set_lon(lons[n]);
+		}
+		writeBlock(out, block);
+	}
+
+	PbfStream in(file);
+	PbfBlock block;
+	check((bool)(in >> block), "block read");
+
+	size_t n = 0;
+	for (PbfBlock::NodeIterator i = block.nodesBegin(); i != block.nodesEnd(); i.next(), n++){
+		Coords coords = (*i).coords();
+		checkCoords("NodeIterator", n, coords.lat, coords.lon);
+	}
+	check(n == (size_t)nodes, "NodeIterator node count");
+
+	Locations locations;
+	apply(block, locations);
+	for (n = 0; n < locations.coords.size(); n++)
+		checkCoords("apply()", n, locations.coords[n].lat, locations.coords[n].lon);
+	check(n == (size_t)nodes, "apply() node count");
+
+	BlockColumns columns;
+	block.columns(columns);
+	for (n = 0; n < columns.nodes.id.size(); n++)
+		checkCoords("columns()", n, columns.nodes.lat[n], columns.nodes.lon[n]);
+	check(n == (size_t)nodes, "columns() node count");
+
+	{
+		ColumnWriter writer(sidecar, file);
+		writer << block;
+		check(writer.finish(), "sidecar written");
+	}
+	ColumnFile columnFile(sidecar, file);
+	check((bool)columnFile && columnFile.blocks() == 1, "sidecar read");
+	if (columnFile && columnFile.blocks() == 1){
+		ColumnBlock columnBlock = columnFile.block(0);
+		n = 0;
+		for (ColumnBlock::NodeIterator i = columnBlock.nodesBegin(); i != columnBlock.nodesEnd(); i.next(), n++){
+			Coords coords = (*i).coords();
+			checkCoords("ColumnFile", n, coords.lat, coords.lon);
+		}
+		check(n == (size_t)nodes, "ColumnFile node count");
+	}
+
+	remove(sidecar);
+	remove(file);
+	return result("coordinates");
+}
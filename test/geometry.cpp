@@ -0,0 +1,66 @@
+#include <iostream>
+#include <vector>
+
+#include "libosmpbf.h"
+#include "test.h"
+
+// Checks that a way only gets an area when it is still a closed ring once
+// the nodes without a location are left out.
+
+using namespace libosmpbf;
+
+// a square of about 1.1 km a side, as nodes 1 to 4, and node 5 in its middle
+static void addSquare(NodeLocations &locations){
+	Coords corners[5];
+	corners[0].lat = 0; corners[0].lon = 0;
+	corners[1].lat = 0; corners[1].lon = 0.01;
+	corners[2].lat = 0.01; corners[2].lon = 0.01;
+	corners[3].lat = 0.01; corners[3].lon = 0;
+	corners[4].lat = 0.005; corners[4].lon = 0.005;
+	for (int n = 0; n < 5; n++)
+		locations.add(n + 1, corners[n]);
+}
+
+// geometry of a way through refs, built into a block of its own
+static WayGeometry geometry(const std::vector<uint64_t> &refs){
+	NodeLocations locations;
+	addSquare(locations);
+
+	Way way;
+	way.id = 1;
+	way.nodeIds.assign(refs.begin(), refs.end());
+	BlockBuilder builder;
+	builder.add(way);
+	PbfBlock block;
+	builder.build(block);
+
+	GeometryBuilder geometries(locations);
+	return geometries.way(*block.waysBegin());
+}
+
+int main(){
+
+	WayGeometry g = geometry({1, 2, 3, 4, 1});
+	check(g.area > 1.2e6 && g.area < 1.3e6 && g.missing == 0, "closed ring has an area");
+
+	g = geometry({1, 2, 5, 3, 4, 1});
+	check(g.area > 0.6e6 && g.missing == 0, "closed ring through the middle has an area");
+
+	// an unknown node between the ends leaves a ring of the same square
+	g = geometry({1, 2, 9, 3, 4, 1});
+	check(g.area > 1.2e6 && g.area < 1.3e6 && g.missing == 1, "ring with an unknown middle node has an area");
+
+	// unknown ends leave an open line
+	g = geometry({9, 1, 2, 3, 4, 9});
+	check(g.area == 0 && g.missing == 2, "ring with unknown ends has no area");
+	check(g.length > 3000, "ring with unknown ends has a length");
+
+	// too few nodes left to enclose anything
+	g = geometry({1, 2, 9, 8, 1});
+	check(g.area == 0 && g.missing == 2, "ring with three nodes left has no area");
+
+	g = geometry({1, 2, 3, 4});
+	check(g.area == 0, "open way has no area");
+
+	return result("geometry");
+}
@@ -0,0 +1,166 @@
+#include <iostream>
+#include <vector>
+
+#include "libosmpbf.h"
+#include "test.h"
+
+// Checks that every node of a block is visited, by NodeIterator and by
+// apply(), whatever shape its groups take. Blocks that BlockBuilder does not
+// make are written with writeBlock() after the OPbfStream header.
+
+using namespace libosmpbf;
+
+static const char *file = "iteration.pbf";
+
+// a block with an empty string table entry 0, as every block has
+static OSMPBF::PrimitiveBlock emptyBlock(){
+	OSMPBF::PrimitiveBlock block;
+	block.mutable_stringtable()->add_s("");
+	block.mutable_stringtable()->add_s("name");
+	block.mutable_stringtable()->add_s("value");
+	return block;
+}
+
+// adds dense nodes with ids from first on, delta coded; tagged[n] tells
+// whether node n gets a name tag
+static void addDense(OSMPBF::PrimitiveGroup &group, uint64_t first, const std::vector<bool> &tagged){
+	OSMPBF::DenseNodes &dense = *group.mutable_dense();
+	bool any = false;
+	for (size_t n = 0; n < tagged.size(); n++)
+		any = any || tagged[n];
+
+	for (size_t n = 0; n < tagged.size(); n++){
+		dense.add_id(n == 0 ? first : 1);
+		dense.add_lat(n == 0 ? 100 : 1);
+		dense.add_lon(n == 0 ? 200 : 1);
+		if (tagged[n]){
+			dense.add_keys_vals(1);
+			dense.add_keys_vals(2);
+		}
+		if (any)
+			dense.add_keys_vals(0);
+	}
+}
+
+static void addPlain(OSMPBF::PrimitiveGroup &group, uint64_t first, size_t count){
+	for (size_t n = 0; n < count; n++){
+		OSMPBF::Node &node = *group.add_nodes();
+		node.set_id(first + n);
+		node.set_lat(100);
+		node.set_lon(200);
+		node.add_keys(1);
+		node.add_vals(2);
+	}
+}
+
+struct Ids {
+	void node(const BlockNode &node){ids.push_back(node.id());}
+	std::vector<uint64_t> ids;
+};
+
+// ids of the nodes of each block, read both ways, must be expected
+static void checkFile(const std::string &name, const std::vector<std::vector<uint64_t> > &expected,
+		const std::vector<std::vector<bool> > &tagged){
+	PbfStream in(file);
+	PbfBlock block;
+	size_t b = 0;
+	while (in >> block){
+		std::string where = name + ", block " + std::to_string(b);
+		if (b >= expected.size()){
+			check(false, where + " is not expected");
+			break;
+		}
+
+		std::vector<uint64_t> ids;
+		size_t n = 0;
+		for (PbfBlock::NodeIterator i = block.nodesBegin(); i != block.nodesEnd(); i.next(), n++){
+			const BlockNode &node = *i;
+			ids.push_back(node.id());
+			if (n < tagged[b].size()){
+				bool hasTag = node.tags() == 1 && node.tags(0).first == "name" && node.tags(0).second == "value";
+				check(tagged[b][n] ? hasTag : node.tags() == 0, where + ", tags of node " + std::to_string(node.id()));
+			}
+		}
+		check(ids == expected[b], where + ", NodeIterator ids");
+
+		Ids visited;
+		apply(block, visited);
+		check(visited.ids == expected[b], where + ", apply() ids");
+		b++;
+	}
+	check(!in.bad(), name + " read");
+	check(b == expected.size(), name + ", block count");
+}
+
+static std::vector<uint64_t> range(uint64_t first, size_t count){
+	std::vector<uint64_t> ids;
+	for (size_t n = 0; n < count; n++)
+		ids.push_back(first + n);
+	return ids;
+}
+
+int main(){
+
+	// a dense group with empty keys_vals, and one with tagged and untagged
+	// nodes mixed, as BlockBuilder writes them
+	{
+		OPbfStream out(file);
+		BlockBuilder builder;
+		for (uint64_t id = 1; id <= 5; id++){
+			Node node;
+			node.id = id;
+			builder.add(node);
+		}
+		PbfBlock block;
+		builder.build(block);
+		out << block;
+
+		for (uint64_t id = 10; id < 16; id++){
+			Node node;
+			node.id = id;
+			if (id % 3 == 0)
+				node.tags["name"] = "value";
+			builder.add(node);
+		}
+		builder.build(block);
+		out << block;
+	}
+	{
+		std::vector<std::vector<uint64_t> > expected = {range(1, 5), range(10, 6)};
+		std::vector<std::vector<bool> > tagged = {std::vector<bool>(5, false),
+			{false, false, true, false, false, true}};
+		checkFile("BlockBuilder blocks", expected, tagged);
+	}
+
+	// dense then plain nodes in one group, a dense group followed by a group
+	// of plain nodes, and a block with no groups at all
+	{
+		OPbfStream out(file);
+
+		OSMPBF::PrimitiveBlock block = emptyBlock();
+		OSMPBF::PrimitiveGroup &group = *block.add_primitivegroup();
+		addDense(group, 1, {true, false, false});
+		addPlain(group, 4, 2);
+		writeBlock(out, block);
+
+		block = emptyBlock();
+		addDense(*block.add_primitivegroup(), 10, {false, false});
+		addPlain(*block.add_primitivegroup(), 12, 3);
+		writeBlock(out, block);
+
+		writeBlock(out, emptyBlock());
+
+		block = emptyBlock();
+		addDense(*block.add_primitivegroup(), 20, {false, true});
+		writeBlock(out, block);
+	}
+	{
+		std::vector<std::vector<uint64_t> > expected = {range(1, 5), range(10, 5), {}, range(20, 2)};
+		std::vector<std::vector<bool> > tagged = {{true, false, false, true, true},
+			{false, false, true, true, true}, {}, {false, true}};
+		checkFile("hand made blocks", expected, tagged);
+	}
+
+	remove(file);
+	return result("iteration");
+}
@@ -0,0 +1,73 @@
+#include <iostream>
+#include <vector>
+#include <unistd.h>
+
+#include "libosmpbf.h"
+#include "test.h"
+
+// Checks that blobs read ahead come back in order and whole, empty blobs
+// included, which are read as empty blocks. A reader that hangs is stopped
+// by an alarm and counts as a failure.
+
+using namespace libosmpbf;
+
+static const char *file = "readahead.pbf";
+
+static void writeNodes(OPbfStream &out, uint64_t first, size_t count){
+	BlockBuilder builder;
+	for (size_t n = 0; n < count; n++){
+		Node node;
+		node.id = first + n;
+		builder.add(node);
+	}
+	PbfBlock block;
+	builder.build(block);
+	out << block;
+}
+
+// node ids of each block of the file, read with the given read-ahead depth
+static std::vector<std::vector<uint64_t> > read(unsigned depth){
+	std::vector<std::vector<uint64_t> > blocks;
+	PbfStream in(file);
+	in.setReadAhead(depth);
+	PbfBlock block;
+	while (in >> block){
+		blocks.push_back(std::vector<uint64_t>());
+		for (PbfBlock::NodeIterator i = block.nodesBegin(); i != block.nodesEnd(); i.next())
+			blocks.back().push_back((*i).id());
+	}
+	check(!in.bad(), std::string(file) + " read with depth " + std::to_string(depth));
+	return blocks;
+}
+
+static void checkDepths(const std::string &name, const std::vector<std::vector<uint64_t> > &expected){
+	unsigned depths[] = {0, 1, 4};
+	for (int d = 0; d < 3; d++)
+		check(read(depths[d]) == expected, name + ", depth " + std::to_string(depths[d]));
+}
+
+int main(){
+
+	alarm(30);
+
+	// an empty blob as the only one, which is all a reader has in flight
+	{
+		OPbfStream out(file);
+		writeBlob(out, "OSMData", "");
+	}
+	checkDepths("only an empty blob", {{}});
+
+	// empty blobs between and after blocks
+	{
+		OPbfStream out(file);
+		writeNodes(out, 1, 3);
+		writeBlob(out, "OSMData", "");
+		writeNodes(out, 10, 2);
+		writeBlob(out, "OSMData", "");
+		writeBlob(out, "OSMData", "");
+	}
+	checkDepths("empty blobs between blocks", {{1, 2, 3}, {}, {10, 11}, {}, {}});
+
+	remove(file);
+	return result("readahead");
+}
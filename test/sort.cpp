@@ -0,0 +1,184 @@
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "libosmpbf.h"
+#include "test.h"
+
+// Checks that PbfSorter puts a shuffled file back in type then id order
+// when it has too little memory to hold it: the objects are written as
+// several runs, each type takes more than one merge pass, and the three
+// types are joined into one file. Every object has to come out as it went
+// in, tags and metadata included, although each block's string table is
+// packed again in an order of its own.
+
+using namespace libosmpbf;
+
+static const char *input = "sort-in.pbf";
+static const char *output = "sort-out.pbf";
+
+static Info info(uint64_t id){
+	Info i;
+	i.version = id % 5 + 1;
+	i.timestamp = 1400000000 + id;
+	i.changeset = id / 10 + 1;
+	i.uid = id % 37 + 1;
+	i.user = "user " + std::to_string(id % 37);
+	return i;
+}
+
+static std::vector<Node> makeNodes(size_t count){
+	std::vector<Node> nodes(count);
+	for (size_t n = 0; n < count; n++){
+		Node &node = nodes[n];
+		node.id = n + 1;
+		node.coords.lat = (double)(n % 1000) / 1000 + 50;
+		node.coords.lon = (double)(n / 1000) / 100 - 3;
+		if (n % 3 == 0){
+			node.tags["name"] = "place " + std::to_string(n % 50);
+			node.tags["place"] = n % 2 ? "village" : "hamlet";
+		}
+		node.info = info(node.id);
+	}
+	return nodes;
+}
+
+static std::vector<Way> makeWays(size_t count){
+	static const char *highways[] = {"residential", "track", "path", "primary"};
+	std::vector<Way> ways(count);
+	for (size_t w = 0; w < count; w++){
+		Way &way = ways[w];
+		way.id = w + 1;
+		for (size_t r = 0; r < w % 7 + 2; r++)
+			way.nodeIds.push_back(w * 5 + r + 1);
+		way.tags["highway"] = highways[w % 4];
+		if (w % 5 == 0)
+			way.tags["name"] = "street " + std::to_string(w % 90);
+		way.info = info(way.id * 3);
+	}
+	return ways;
+}
+
+static std::vector<Relation> makeRelations(size_t count){
+	std::vector<Relation> relations(count);
+	for (size_t r = 0; r < count; r++){
+		Relation &relation = relations[r];
+		relation.id = r + 1;
+		relation.members.push_back(Relation::Member(r * 2 + 1, Member_Way, "outer"));
+		relation.members.push_back(Relation::Member(r * 7 + 1, Member_Node, "label " + std::to_string(r % 11)));
+		if (r > 0)
+			relation.members.push_back(Relation::Member(r, Member_Relation, "subarea"));
+		relation.tags["type"] = r % 2 ? "multipolygon" : "boundary";
+		relation.info = info(relation.id * 11);
+	}
+	return relations;
+}
+
+static bool sameInfo(const Info &a, const Info &b){
+	return a.version == b.version && a.timestamp == b.timestamp && a.changeset == b.changeset
+		&& a.uid == b.uid && a.user == b.user;
+}
+
+static bool same(const Node &a, const Node &b){
+	return a.id == b.id && std::llround(a.coords.lat * 1e7) == std::llround(b.coords.lat * 1e7)
+		&& std::llround(a.coords.lon * 1e7) == std::llround(b.coords.lon * 1e7)
+		&& a.tags == b.tags && sameInfo(a.info, b.info);
+}
+
+static bool same(const Way &a, const Way &b){
+	return a.id == b.id && a.nodeIds == b.nodeIds && a.tags == b.tags && sameInfo(a.info, b.info);
+}
+
+static bool same(const Relation &a, const Relation &b){
+	if (a.id != b.id || a.members.size() != b.members.size() || a.tags != b.tags || !sameInfo(a.info, b.info))
+		return false;
+	Relation::MemberList::const_iterator m = a.members.begin(), n = b.members.begin();
+	for (; m != a.members.end(); m++, n++){
+		if (m->id != n->id || m->type != n->type || m->role != n->role)
+			return false;
+	}
+	return true;
+}
+
+template <typename T>
+static void checkObjects(const std::vector<T> &found, const std::vector<T> &expected, const std::string &what){
+	check(found.size() == expected.size(), what + " count");
+	size_t wrong = 0;
+	for (size_t n = 0; n < found.size() && n < expected.size(); n++){
+		if (!same(found[n], expected[n]))
+			wrong++;
+	}
+	check(wrong == 0, what + " match the sorted original, " + std::to_string(wrong) + " differ");
+}
+
+int main(){
+	std::vector<Node> nodes = makeNodes(20000);
+	std::vector<Way> ways = makeWays(3000);
+	std::vector<Relation> relations = makeRelations(400);
+
+	// the same objects shuffled, with the types mixed in every block
+	{
+		std::vector<Node> n(nodes);
+		std::vector<Way> w(ways);
+		std::vector<Relation> r(relations);
+		std::mt19937 random(1);
+		std::shuffle(n.begin(), n.end(), random);
+		std::shuffle(w.begin(), w.end(), random);
+		std::shuffle(r.begin(), r.end(), random);
+
+		OPbfStream out(input);
+		BlockBuilder builder;
+		size_t nn = 0, nw = 0, nr = 0;
+		while (nn < n.size() || nw < w.size() || nr < r.size()){
+			switch (random() % 3){
+			case 0: if (nn < n.size()) builder.add(n[nn++]); break;
+			case 1: if (nw < w.size()) builder.add(w[nw++]); break;
+			case 2: if (nr < r.size()) builder.add(r[nr++]); break;
+			}
+			if (builder.objects() >= 2000 || (nn == n.size() && nw == w.size() && nr == r.size())){
+				PbfBlock block;
+				builder.build(block);
+				out << block;
+			}
+		}
+	}
+
+	// with so small a budget a merge takes two runs at once, and the
+	// blocks make many more runs than that
+	PbfSorter sorter(256*1024, ".");
+	check(sorter.sort(input, output), "sort succeeds");
+	check(sorter.runs() > 2, "sort writes more runs than one merge takes, " + std::to_string(sorter.runs()) + " runs");
+
+	std::vector<Node> sortedNodes;
+	std::vector<Way> sortedWays;
+	std::vector<Relation> sortedRelations;
+	bool ordered = true;
+	{
+		PbfStream in(output);
+		PbfBlock block;
+		while (in >> block){
+			for (PbfBlock::NodeIterator i = block.nodesBegin(); i != block.nodesEnd(); i.next()){
+				ordered = ordered && sortedWays.empty() && sortedRelations.empty();
+				sortedNodes.push_back((*i).clone());
+			}
+			for (PbfBlock::WayIterator i = block.waysBegin(); i != block.waysEnd(); i.next()){
+				ordered = ordered && sortedRelations.empty();
+				sortedWays.push_back((*i).clone());
+			}
+			for (PbfBlock::RelationIterator i = block.relationsBegin(); i != block.relationsEnd(); i.next())
+				sortedRelations.push_back((*i).clone());
+		}
+		check(!in.bad(), "sorted file read");
+	}
+	remove(input);
+	remove(output);
+
+	check(ordered, "nodes, then ways, then relations");
+	checkObjects(sortedNodes, nodes, "nodes");
+	checkObjects(sortedWays, ways, "ways");
+	checkObjects(sortedRelations, relations, "relations");
+
+	return result("sort");
+}
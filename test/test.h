@@ -0,0 +1,64 @@
+#ifndef TEST_H
+#define TEST_H
+
+#include <iostream>
+#include <string>
+#include <zlib.h>
+#include <netinet/in.h>
+
+#include "protobuf/osm.pb.h"
+
+// helpers shared by the check programs
+
+static int failures = 0;
+
+inline void check(bool ok, const std::string &what){
+	if (!ok){
+		std::cout << "FAIL: " << what << "\n";
+		failures++;
+	}
+}
+
+// reports the outcome of a program's checks and returns its exit status
+inline int result(const char *name){
+	if (failures > 0){
+		std::cout << name << ": " << failures << " checks failed\n";
+		return 1;
+	}
+	std::cout << name << ": all checks passed\n";
+	return 0;
+}
+
+// writes a blob of type with the given data, as OPbfStream frames them
+inline void writeBlob(std::ostream &out, const std::string &type, const std::string &data){
+	OSMPBF::BlobHeader header;
+	header.set_type(type);
+	header.set_datasize(data.size());
+	std::string head;
+	header.SerializeToString(&head);
+
+	uint32_t length = htonl(head.size());
+	out.write((const char*)&length, sizeof(length));
+	out << head << data;
+}
+
+// writes block as a zlib compressed OSMData blob, for blocks BlockBuilder
+// does not make
+inline void writeBlock(std::ostream &out, const OSMPBF::PrimitiveBlock &block){
+	std::string raw;
+	block.SerializeToString(&raw);
+
+	uLongf size = compressBound(raw.size());
+	std::string zlib(size, '\0');
+	compress((Bytef*)&zlib[0], &size, (const Bytef*)raw.data(), raw.size());
+	zlib.resize(size);
+
+	OSMPBF::Blob blob;
+	blob.set_raw_size(raw.size());
+	blob.set_zlib_data(zlib);
+	std::string data;
+	blob.SerializeToString(&data);
+	writeBlob(out, "OSMData", data);
+}
+
+#endif
@@ -0,0 +1,29 @@
+#include <iostream>
+#include <stdlib.h>
+
+#include "libosmpbf.h"
+
+// Rewrites a PBF file in type then id order, holding at most about MEMORY
+// megabytes of it at once. Runs that do not fit are kept in TEMPDIR.
+
+using namespace libosmpbf;
+
+int main(int argc, char *argv[]){
+
+	if (argc < 3 || argc > 5){
+		std::cout << "Usage: " << argv[0] << " [INPUT] [OUTPUT] [MEMORY] [TEMPDIR]\n";
+		return 0;
+	}
+
+	size_t megabytes = argc >= 4 ? atoi(argv[3]) : 1024;
+	const char *tempDir = argc == 5 ? argv[4] : "/tmp";
+
+	PbfSorter sorter(megabytes*1024*1024, tempDir);
+	if (!sorter.sort(argv[1], argv[2])){
+		std::cout << "Unable to sort " << argv[1] << " into " << argv[2] << "\n";
+		return 1;
+	}
+
+	std::cout << "Sorted " << argv[1] << " in " << sorter.runs() << (sorter.runs() == 1 ? " run\n" : " runs\n");
+	return 0;
+}